@@ -0,0 +1,251 @@
+/*  bench_lindo.c
+    Baseline timings of LINDO API entry points called directly from C, to
+    compare with the same calls made through rLindo (see bench_rlindo.R).
+
+    Build on Linux (use bin/osx64x86 or bin/osx64arm on macOS):
+        cc -O2 -o bench_lindo bench_lindo.c -I$LINDOAPI_HOME/include \
+           -L$LINDOAPI_HOME/bin/linux64 -llindo64 -lm -lpthread
+    Build on Windows (Rtools gcc, adjust 16_0 to the installed version):
+        gcc -O2 -o bench_lindo.exe bench_lindo.c -I"%LINDOAPI_HOME%/include" \
+            -L"%LINDOAPI_HOME%/bin/win64" -llindo64_16_0
+
+    Run:
+        bench_lindo [-r reps] [-m maxnnz] > bench_c.csv
+
+    Writes one CSV row per measurement:
+        lang,op,nnz,calls,seconds,us_per_call
+    Copyright (C) 2017-2025 LINDO Systems.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lindo.h"
+
+#ifdef _WIN32
+#include <windows.h>
+static double benchNow(void)
+{
+    LARGE_INTEGER freq, count;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart / (double)freq.QuadPart;
+}
+#else
+#include <time.h>
+static double benchNow(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+#endif
+
+/* Nonzeros per column of the generated models */
+#define BENCH_COL_NNZ 10
+
+/* Covering LP with nnz/10 rows and columns and 10 nonzeros per column:
+   min sum(x) s.t. A x >= 10, x >= 0. bench_rlindo.R builds the same model. */
+typedef struct benchLP {
+    int    nVars;
+    int    nCons;
+    int    nNnz;
+    double *padC;
+    double *padB;
+    char   *pachConTypes;
+    int    *paiAcols;
+    double *padAcoef;
+    int    *paiArows;
+} benchLP;
+
+static int benchMakeLP(benchLP *pLP, int nNnz)
+{
+    int j, t;
+
+    memset(pLP, 0, sizeof(benchLP));
+    pLP->nVars = nNnz / BENCH_COL_NNZ;
+    pLP->nCons = pLP->nVars;
+    pLP->nNnz = pLP->nVars * BENCH_COL_NNZ;
+    pLP->padC = (double*)malloc(pLP->nVars * sizeof(double));
+    pLP->padB = (double*)malloc(pLP->nCons * sizeof(double));
+    pLP->pachConTypes = (char*)malloc(pLP->nCons + 1);
+    pLP->paiAcols = (int*)malloc((pLP->nVars + 1) * sizeof(int));
+    pLP->padAcoef = (double*)malloc(pLP->nNnz * sizeof(double));
+    pLP->paiArows = (int*)malloc(pLP->nNnz * sizeof(int));
+    if(!pLP->padC || !pLP->padB || !pLP->pachConTypes || !pLP->paiAcols ||
+       !pLP->padAcoef || !pLP->paiArows)
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+
+    for(j = 0; j < pLP->nVars; j++)
+    {
+        pLP->padC[j] = 1.0;
+        pLP->paiAcols[j] = j * BENCH_COL_NNZ;
+        for(t = 0; t < BENCH_COL_NNZ; t++)
+        {
+            pLP->paiArows[j * BENCH_COL_NNZ + t] = (j + t * (pLP->nCons / BENCH_COL_NNZ)) % pLP->nCons;
+            pLP->padAcoef[j * BENCH_COL_NNZ + t] = 1.0 + (j + t) % 5;
+        }
+    }
+    pLP->paiAcols[pLP->nVars] = pLP->nNnz;
+    for(j = 0; j < pLP->nCons; j++)
+    {
+        pLP->padB[j] = BENCH_COL_NNZ;
+        pLP->pachConTypes[j] = 'G';
+    }
+    pLP->pachConTypes[pLP->nCons] = '\0';
+
+    return LSERR_NO_ERROR;
+}
+
+static void benchFreeLP(benchLP *pLP)
+{
+    free(pLP->padC);
+    free(pLP->padB);
+    free(pLP->pachConTypes);
+    free(pLP->paiAcols);
+    free(pLP->padAcoef);
+    free(pLP->paiArows);
+}
+
+static int benchLoad(pLSmodel pModel, benchLP *pLP)
+{
+    return LSloadLPData(pModel, pLP->nCons, pLP->nVars, LS_MIN, 0.0, pLP->padC, pLP->padB,
+                        pLP->pachConTypes, pLP->nNnz, pLP->paiAcols, NULL, pLP->padAcoef,
+                        pLP->paiArows, NULL, NULL);
+}
+
+static void benchReport(const char *szOp, int nNnz, int nCalls, double dSeconds)
+{
+    printf("C,%s,%d,%d,%.9g,%.6g\n", szOp, nNnz, nCalls, dSeconds,
+           nCalls > 0 ? dSeconds / nCalls * 1e6 : 0.0);
+    fflush(stdout);
+}
+
+static int LS_CALLTYPE benchCallback(pLSmodel pModel, int nLocation, void *pData)
+{
+    (*(int*)pData)++;
+    return 0;
+}
+
+#define BENCH_CHECK(call) {if ((nErrorCode = (call)) != LSERR_NO_ERROR) {\
+    fprintf(stderr, "%s failed (error %d)\n", #call, nErrorCode); goto Terminate;}}
+
+int main(int argc, char **argv)
+{
+    int      nErrorCode = LSERR_NO_ERROR;
+    char     MY_LICENSE_KEY[1024];
+    char     pachLicPath[1024];
+    char     szName[256];
+    pLSenv   pEnv = NULL;
+    pLSmodel pModel = NULL;
+    benchLP  lp;
+    int      nReps = 1000, nMaxNnz = 10000000, nBaseNnz = 100000;
+    int      k, nNnz, nStatus, nCallbacks, iCon;
+    double   dStart, dPlain, dB, *padX = NULL;
+
+    for(k = 1; k + 1 < argc; k += 2)
+    {
+        if(strcmp(argv[k], "-r") == 0) nReps = atoi(argv[k + 1]);
+        else if(strcmp(argv[k], "-m") == 0) nMaxNnz = atoi(argv[k + 1]);
+    }
+    if(nBaseNnz > nMaxNnz) nBaseNnz = nMaxNnz;
+    memset(&lp, 0, sizeof(lp));
+
+    if(getenv("LINDOAPI_HOME") == NULL)
+    {
+        fprintf(stderr, "LINDOAPI_HOME is not set\n");
+        return 1;
+    }
+    sprintf(pachLicPath, "%s//license//lndapi%d%d.lic", getenv("LINDOAPI_HOME"),
+            LS_MAJOR_VER_NUMBER, LS_MINOR_VER_NUMBER);
+    BENCH_CHECK(LSloadLicenseString(pachLicPath, MY_LICENSE_KEY));
+    pEnv = LScreateEnv(&nErrorCode, MY_LICENSE_KEY);
+    if(nErrorCode) goto Terminate;
+    BENCH_CHECK(LSsetEnvDouParameter(pEnv, LS_DPARAM_CALLBACKFREQ, 0.0));
+
+    printf("lang,op,nnz,calls,seconds,us_per_call\n");
+
+    /* LSloadLPData into a new model, 1e3..1e7 nonzeros */
+    for(nNnz = 1000; nNnz <= nMaxNnz; nNnz *= 10)
+    {
+        int nLoads = nNnz >= 1000000 ? 3 : 10;
+
+        BENCH_CHECK(benchMakeLP(&lp, nNnz));
+        dPlain = 0.0;
+        for(k = 0; k < nLoads; k++)
+        {
+            pModel = LScreateModel(pEnv, &nErrorCode);
+            if(nErrorCode) goto Terminate;
+            dStart = benchNow();
+            BENCH_CHECK(benchLoad(pModel, &lp));
+            dPlain += benchNow() - dStart;
+            LSdeleteModel(&pModel);
+        }
+        benchReport("loadLPData", lp.nNnz, nLoads, dPlain);
+        benchFreeLP(&lp);
+        memset(&lp, 0, sizeof(lp));
+    }
+
+    /* calls on a solved model */
+    BENCH_CHECK(benchMakeLP(&lp, nBaseNnz));
+    padX = (double*)malloc(lp.nVars * sizeof(double));
+    if(padX == NULL)
+    {
+        nErrorCode = LSERR_OUT_OF_MEMORY;
+        goto Terminate;
+    }
+
+    /* the callback cost is the solve time difference spread over the calls */
+    pModel = LScreateModel(pEnv, &nErrorCode);
+    if(nErrorCode) goto Terminate;
+    BENCH_CHECK(benchLoad(pModel, &lp));
+    dStart = benchNow();
+    BENCH_CHECK(LSoptimize(pModel, LS_METHOD_PSIMPLEX, &nStatus));
+    dPlain = benchNow() - dStart;
+    LSdeleteModel(&pModel);
+
+    pModel = LScreateModel(pEnv, &nErrorCode);
+    if(nErrorCode) goto Terminate;
+    BENCH_CHECK(benchLoad(pModel, &lp));
+    nCallbacks = 0;
+    BENCH_CHECK(LSsetCallback(pModel, benchCallback, &nCallbacks));
+    dStart = benchNow();
+    BENCH_CHECK(LSoptimize(pModel, LS_METHOD_PSIMPLEX, &nStatus));
+    benchReport("callback", lp.nNnz, nCallbacks, benchNow() - dStart - dPlain);
+    BENCH_CHECK(LSsetCallback(pModel, NULL, NULL));
+
+    dStart = benchNow();
+    for(k = 0; k < nReps; k++)
+    {
+        BENCH_CHECK(LSgetPrimalSolution(pModel, padX));
+    }
+    benchReport("getPrimalSolution", lp.nNnz, nReps, benchNow() - dStart);
+
+    dStart = benchNow();
+    for(k = 0; k < nReps; k++)
+    {
+        iCon = k % lp.nCons;
+        dB = BENCH_COL_NNZ + (k & 1);
+        BENCH_CHECK(LSmodifyRHS(pModel, 1, &iCon, &dB));
+    }
+    benchReport("modifyRHS", lp.nNnz, nReps, benchNow() - dStart);
+
+    dStart = benchNow();
+    for(k = 0; k < nReps; k++)
+    {
+        BENCH_CHECK(LSgetVariableNamej(pModel, k % lp.nVars, szName));
+    }
+    benchReport("getVariableNamej", lp.nNnz, nReps, benchNow() - dStart);
+
+Terminate:
+    free(padX);
+    benchFreeLP(&lp);
+    if(pModel) LSdeleteModel(&pModel);
+    if(pEnv) LSdeleteEnv(&pEnv);
+
+    return nErrorCode ? 1 : 0;
+}
@@ -6,6 +6,7 @@
 
 
 #include "rLindo.h"
+#include "R_ext/Rdynload.h"
 
 #define LSASSERT(a) {if ((errorcode = (a)) != 0) goto ErrorReturn;}
 
@@ -42,6 +43,9 @@ BOOL WINAPI DllMain(HINSTANCE module_handle, DWORD reason_for_call, LPVOID reser
 
     return TRUE;
 }
+#else
+#include <time.h>
+#include <pthread.h>
 #endif
 
 #define INI_ERR_CODE \
@@ -50,7 +54,9 @@ nProtect += 1;\
 pnErrorCode = INTEGER_POINTER(spnErrorCode);\
 *pnErrorCode = LSERR_NO_ERROR;\
 
-#define CHECK_MODEL_ERROR \
+/* The CHECK_*_HANDLE forms only validate the R handle, for wrappers that do
+   not use the LINDO object itself */
+#define CHECK_MODEL_HANDLE \
 if(sModel != R_NilValue && R_ExternalPtrTag(sModel) == tagLSprob)\
 {\
     prModel = (prLSmodel)R_ExternalPtrAddr(sModel);\
@@ -59,7 +65,10 @@ if(sModel != R_NilValue && R_ExternalPtrTag(sModel) == tagLSprob)\
         *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
         goto ErrorReturn;\
     }\
-    pModel = prModel->pModel;\
+    if(prModel->pAsync != NULL && rAsyncBusy(prModel))\
+    {\
+        error("rLindo Error: the model is being solved in the background");\
+    }\
 }\
 else\
 {\
@@ -67,7 +76,11 @@ else\
     goto ErrorReturn;\
 }\
 
-#define CHECK_ENV_ERROR \
+#define CHECK_MODEL_ERROR \
+CHECK_MODEL_HANDLE \
+pModel = prModel->pModel;\
+
+#define CHECK_ENV_HANDLE \
 if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv)\
 {\
     prEnv = (prLSenv)R_ExternalPtrAddr(sEnv);\
@@ -76,7 +89,6 @@ if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv)\
         *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
         goto ErrorReturn;\
     }\
-    pEnv = prEnv->pEnv;\
 }\
 else\
 {\
@@ -84,7 +96,11 @@ else\
     goto ErrorReturn;\
 }\
 
-#define CHECK_SAMPLE_ERROR \
+#define CHECK_ENV_ERROR \
+CHECK_ENV_HANDLE \
+pEnv = prEnv->pEnv;\
+
+#define CHECK_SAMPLE_HANDLE \
 if(sSample != R_NilValue && R_ExternalPtrTag(sSample) == tagLSsample)\
 {\
     prSample = (prLSsample)R_ExternalPtrAddr(sSample);\
@@ -93,7 +109,6 @@ if(sSample != R_NilValue && R_ExternalPtrTag(sSample) == tagLSsample)\
         *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
         goto ErrorReturn;\
     }\
-    pSample = prSample->pSample;\
 }\
 else\
 {\
@@ -101,7 +116,11 @@ else\
     goto ErrorReturn;\
 }\
 
-#define CHECK_RG_ERROR \
+#define CHECK_SAMPLE_ERROR \
+CHECK_SAMPLE_HANDLE \
+pSample = prSample->pSample;\
+
+#define CHECK_RG_HANDLE \
 if(sRG != R_NilValue && R_ExternalPtrTag(sRG) == tagLSrandGen)\
 {\
     prRG = (prLSrandGen)R_ExternalPtrAddr(sRG);\
@@ -110,7 +129,42 @@ if(sRG != R_NilValue && R_ExternalPtrTag(sRG) == tagLSrandGen)\
         *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
         goto ErrorReturn;\
     }\
-    pRG = prRG->pRG;\
+}\
+else\
+{\
+    *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
+    goto ErrorReturn;\
+}\
+
+#define CHECK_RG_ERROR \
+CHECK_RG_HANDLE \
+pRG = prRG->pRG;\
+
+#define CHECK_BUILDER_ERROR \
+if(sBuilder != R_NilValue && R_ExternalPtrTag(sBuilder) == tagLSbuilder)\
+{\
+    prBuilder = (prLSbuilder)R_ExternalPtrAddr(sBuilder);\
+    if(prBuilder == NULL)\
+    {\
+        *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
+        goto ErrorReturn;\
+    }\
+}\
+else\
+{\
+    *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
+    goto ErrorReturn;\
+}\
+
+#define CHECK_ASYNC_ERROR \
+if(sAsync != R_NilValue && R_ExternalPtrTag(sAsync) == tagLSasync)\
+{\
+    pAsync = (rLSasync*)R_ExternalPtrAddr(sAsync);\
+    if(pAsync == NULL)\
+    {\
+        *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;\
+        goto ErrorReturn;\
+    }\
 }\
 else\
 {\
@@ -170,12 +224,18 @@ else\
     carrayname = INTEGER(scarrayname);\
 }\
 
+/* The names vector of each wrapper is built on its first call and reused.
+   Raw mode returns lists of at most two items unwrapped, so they are
+   collected in a reused scratch list and never named. */
 #define SET_UP_LIST \
-PROTECT(rList = allocVector(VECSXP, nNumItems));\
-PROTECT(ListNames = allocVector(STRSXP,nNumItems));\
-for(nIdx = 0; nIdx < nNumItems; nIdx++)\
-    SET_STRING_ELT(ListNames,nIdx,mkChar(Names[nIdx]));\
-setAttrib(rList, R_NamesSymbol, ListNames);\
+PROTECT(rList = rNewResultList(nNumItems));\
+{\
+    static SEXP sCachedNames = NULL;\
+    PROTECT(ListNames = rLindoRawMode && nNumItems <= 2 ? R_NilValue :\
+            rGetListNames(&sCachedNames, Names, nNumItems));\
+}\
+if(ListNames != R_NilValue)\
+    setAttrib(rList, R_NamesSymbol, ListNames);\
 
 #define SET_PRINT_LOG(pModel,nErrorCode)\
 nErrorCode = LSsetModelLogfunc(pModel,(printLOG_t)rPrintLog,NULL);\
@@ -193,8 +253,11 @@ if(nErrorCode)\
     R_FlushConsole();\
 }\
 
-#define SET_MODEL_CALLBACK(pModel,nErrorCode)\
-nErrorCode = LSsetCallback(pModel,(cbFunc_t)rCallBack,NULL);\
+#define SET_MODEL_CALLBACK(pModel,prModel,nErrorCode)\
+(prModel)->nCbIntervalMs = rLindoCbIntervalMs;\
+(prModel)->dLastEventsMs = 0;\
+nErrorCode = rLindoCbIntervalMs < 0 ? LSERR_NO_ERROR :\
+    LSsetCallback(pModel,(cbFunc_t)rCallBack,prModel);\
 if(nErrorCode != LSERR_NO_ERROR)\
 {\
     Rprintf("Failed to set callback (error %d)\n",nErrorCode);\
@@ -205,486 +268,894 @@ SEXP tagLSprob;
 SEXP tagLSenv;
 SEXP tagLSsample;
 SEXP tagLSrandGen;
+SEXP tagLSbuilder;
+SEXP tagLSasync;
 
-static void LS_CALLTYPE rPrintLog(pLSmodel model,
-                                  char     *line,
-                                  void     *notting)
-{
-    Rprintf("%s",line);
-    R_FlushConsole();
-}
+/* defined with the asynchronous solve routines */
+static int rAsyncBusy(prLSmodel prModel);
+static void rAsyncStop(struct rLSasync *pAsync);
 
-int CALLBACKTYPE rCallBack(pLSmodel model,
-                           int      nLocation,
-                           void     *pData)
+/* when set, wrappers return their payload directly and raise R errors */
+static int rLindoRawMode = 0;
+
+/* default callback interval in milliseconds for new models, <0 disables */
+static int rLindoCbIntervalMs = 100;
+
+static SEXP rGetListNames(SEXP *psNames,
+                          char **Names,
+                          int  nNumItems)
 {
-    R_ProcessEvents();
-    return 0;
+    int  nIdx;
+    SEXP sNames;
+
+    if(*psNames == NULL)
+    {
+        PROTECT(sNames = allocVector(STRSXP, nNumItems));
+        for(nIdx = 0; nIdx < nNumItems; nIdx++)
+            SET_STRING_ELT(sNames, nIdx, mkChar(Names[nIdx]));
+        MARK_NOT_MUTABLE(sNames);
+        R_PreserveObject(sNames);
+        UNPROTECT(1);
+        *psNames = sNames;
+    }
+
+    return *psNames;
 }
 
-int  CALLBACKTYPE rMipCallBack(pLSmodel model,
-                               void     *pvUserData,
-                               double   dObjval,
-                               double   *padPrimal)
+/* Scratch result lists of one and two items for raw mode, see SET_UP_LIST */
+static SEXP rLindoScratchList[2] = {NULL, NULL};
+
+static SEXP rNewResultList(int nNumItems)
 {
-    return 0;
+    if(!rLindoRawMode || nNumItems < 1 || nNumItems > 2)
+    {
+        return allocVector(VECSXP, nNumItems);
+    }
+
+    if(rLindoScratchList[nNumItems - 1] == NULL)
+    {
+        rLindoScratchList[nNumItems - 1] = allocVector(VECSXP, nNumItems);
+        R_PreserveObject(rLindoScratchList[nNumItems - 1]);
+    }
+
+    return rLindoScratchList[nNumItems - 1];
 }
 
-/******************************************************
- * Structure Creation and Deletion Routines (5)       *
- ******************************************************/
-SEXP rcLScreateEnv()
+static SEXP rReturnList(SEXP rList)
 {
-    int      nErrorCode = LSERR_NO_ERROR;
-    char     MY_LICENSE_KEY[1024];
-    pLSenv   pEnv;
-    prLSenv  prEnv = NULL;
-    char     pachLicPath[256];
-    SEXP     sEnv = R_NilValue;
-
-    tagLSprob = Rf_install("TYPE_LSPROB");
-    tagLSenv = Rf_install("TYPE_LSENV");
-    tagLSsample = Rf_install("TYPE_LSSAMP");
-    tagLSrandGen = Rf_install("TYPE_LSRG");
+    int  nErrorCode, nLen;
+    SEXP sValue;
 
-    prEnv = (prLSenv)malloc(sizeof(rLSenv)*1);
-    if(prEnv == NULL)
+    if(!rLindoRawMode)
     {
-        return R_NilValue;
+        return rList;
     }
 
+    nErrorCode = INTEGER(VECTOR_ELT(rList, 0))[0];
+    nLen = Rf_length(rList);
+    if(nLen > 2)
     {
-      sprintf(pachLicPath, "%s//license//lndapi%d%d.lic", getenv("LINDOAPI_HOME"), LS_MAJOR_VER_NUMBER, LS_MINOR_VER_NUMBER);
-#if 0
-      fprintf(stdout, "Loading license file '%s'\n", pachLicPath); fflush(stdout);
-#endif
-      nErrorCode = LSloadLicenseString(pachLicPath, MY_LICENSE_KEY);
-      if (nErrorCode != LSERR_NO_ERROR)
-      {
-        Rprintf("Failed to load license key (error %d)\n", nErrorCode);
-        R_FlushConsole();
-        return R_NilValue;
-      }
+        if(nErrorCode != LSERR_NO_ERROR)
+        {
+            error("rLindo Error: LINDO API returned error code %d", nErrorCode);
+        }
+        return rList;
     }
 
-
-    pEnv = LScreateEnv(&nErrorCode, MY_LICENSE_KEY);
-    if(nErrorCode)
+    //empty the scratch list so that it does not keep the result alive
+    sValue = nLen == 2 ? VECTOR_ELT(rList, 1) : R_NilValue;
+    SET_VECTOR_ELT(rList, 0, R_NilValue);
+    if(nLen == 2)
     {
-        Rprintf("Failed to create enviroment object (error %d)\n",nErrorCode);
-        R_FlushConsole();
-        return R_NilValue;
+        SET_VECTOR_ELT(rList, 1, R_NilValue);
+    }
+    if(nErrorCode != LSERR_NO_ERROR)
+    {
+        error("rLindo Error: LINDO API returned error code %d", nErrorCode);
     }
 
-    prEnv->pEnv = pEnv;
+    return sValue;
+}
 
-    sEnv = R_MakeExternalPtr(prEnv,R_NilValue,R_NilValue);
+static rLindoData_t *rNewCbData(void)
+{
+    return (rLindoData_t*)calloc(1, sizeof(rLindoData_t));
+}
 
-    R_SetExternalPtrTag(sEnv,tagLSenv);
+/* Replaces a preserved callback slot, pass R_NilValue to clear it */
+static void rSetCbSlot(SEXP *psSlot,
+                       SEXP sValue)
+{
+    if(*psSlot != NULL)
+    {
+        R_ReleaseObject(*psSlot);
+        *psSlot = NULL;
+    }
 
-    return sEnv;
+    if(sValue != R_NilValue)
+    {
+        R_PreserveObject(sValue);
+        *psSlot = sValue;
+    }
 }
 
-
-SEXP rcLScreateEnvByKey(SEXP slicenseKey)
+static void rFreeFunCache(rLindoFunCache_t *pCache)
 {
-  int      nErrorCode = LSERR_NO_ERROR;
-  char     MY_LICENSE_KEY[1024];
-  pLSenv   pEnv;
-  prLSenv  prEnv = NULL;
-  char     pachLicPath[256];
-  SEXP     sEnv = R_NilValue;
-  char* licenseKey = (char*)CHAR(STRING_ELT(slicenseKey, 0));
+    if(pCache == NULL)
+    {
+        return;
+    }
 
-  tagLSprob = Rf_install("TYPE_LSPROB");
-  tagLSenv = Rf_install("TYPE_LSENV");
-  tagLSsample = Rf_install("TYPE_LSSAMP");
-  tagLSrandGen = Rf_install("TYPE_LSRG");
+    free(pCache->pbValid);
+    free(pCache->pnHash);
+    free(pCache->padX);
+    free(pCache->padF);
+    free(pCache);
+}
 
-  prEnv = (prLSenv)malloc(sizeof(rLSenv) * 1);
-  if (prEnv == NULL)
-  {
-    return R_NilValue;
-  }
+static rLindoFunCache_t *rNewFunCache(int nEntries,
+                                      int nVars,
+                                      int nCons)
+{
+    rLindoFunCache_t *pCache;
 
-  if (!licenseKey) {
-    sprintf(pachLicPath, "%s//license//lndapi%d%d.lic", getenv("LINDOAPI_HOME"), LS_MAJOR_VER_NUMBER, LS_MINOR_VER_NUMBER);
-#if 0
-    fprintf(stdout, "Loading license file '%s'\n", pachLicPath); fflush(stdout);
-#endif
-    nErrorCode = LSloadLicenseString(pachLicPath, MY_LICENSE_KEY);
-    if (nErrorCode != LSERR_NO_ERROR)
+    pCache = (rLindoFunCache_t*)calloc(1, sizeof(rLindoFunCache_t));
+    if(pCache == NULL)
     {
-      Rprintf("Failed to load license key (error %d)\n", nErrorCode);
-      R_FlushConsole();
-      return R_NilValue;
+        return NULL;
     }
-  }
-  else {
-    strncpy(MY_LICENSE_KEY, licenseKey, 1024-1);
-  }
-
-
-  pEnv = LScreateEnv(&nErrorCode, MY_LICENSE_KEY);
-  if (nErrorCode)
-  {
-    Rprintf("Failed to create enviroment object (error %d)\n", nErrorCode);
-    R_FlushConsole();
-    return R_NilValue;
-  }
 
-  prEnv->pEnv = pEnv;
+    pCache->nEntries = nEntries;
+    pCache->pbValid = (int*)calloc(nEntries, sizeof(int));
+    pCache->pnHash = (unsigned long long*)calloc(nEntries, sizeof(unsigned long long));
+    pCache->padX = (double*)malloc((size_t)nEntries * (nVars > 0 ? nVars : 1) * sizeof(double));
+    pCache->padF = (double*)malloc((size_t)nEntries * (nCons + 1) * sizeof(double));
+    if(!pCache->pbValid || !pCache->pnHash || !pCache->padX || !pCache->padF)
+    {
+        rFreeFunCache(pCache);
+        return NULL;
+    }
 
-  sEnv = R_MakeExternalPtr(prEnv, R_NilValue, R_NilValue);
+    return pCache;
+}
 
-  R_SetExternalPtrTag(sEnv, tagLSenv);
+static void rFreeGradCache(rLindoGradCache_t *pCache)
+{
+    if(pCache == NULL)
+    {
+        return;
+    }
 
-  return sEnv;
+    free(pCache->padX);
+    free(pCache->paiRowBeg);
+    free(pCache->paiVar);
+    free(pCache->padVal);
+    free(pCache->padWork);
+    free(pCache);
 }
 
-
-SEXP rcLScreateModel(SEXP sEnv)
+static rLindoGradCache_t *rNewGradCache(int nVars,
+                                        int nCons)
 {
-    int       nErrorCode = LSERR_NO_ERROR;
-    prLSenv   prEnv = NULL;
-    pLSenv    pEnv = NULL;
-    prLSmodel prModel = NULL;
-    pLSmodel  pModel = NULL;
-    SEXP      sModel = R_NilValue;
+    rLindoGradCache_t *pCache;
 
-    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv)
+    pCache = (rLindoGradCache_t*)calloc(1, sizeof(rLindoGradCache_t));
+    if(pCache == NULL)
     {
-        prEnv = (prLSenv)R_ExternalPtrAddr(sEnv);
-        if(prEnv == NULL)
-        {
-            nErrorCode = LSERR_ILLEGAL_NULL_POINTER;
-            Rprintf("Failed to create model object (error %d)\n",nErrorCode);
-            R_FlushConsole();
-            return R_NilValue;
-        }
-        pEnv = prEnv->pEnv;
+        return NULL;
     }
-    else
+
+    pCache->nVars = nVars;
+    pCache->nRows = nCons + 1;
+    pCache->padX = (double*)malloc((nVars > 0 ? nVars : 1) * sizeof(double));
+    pCache->paiRowBeg = (int*)calloc(pCache->nRows + 1, sizeof(int));
+    pCache->padWork = (double*)calloc(nVars > 0 ? nVars : 1, sizeof(double));
+    if(!pCache->padX || !pCache->paiRowBeg || !pCache->padWork)
     {
-        nErrorCode = LSERR_ILLEGAL_NULL_POINTER;
-        Rprintf("Failed to create model object (error %d)\n",nErrorCode);
-        R_FlushConsole();
-        return R_NilValue;
+        rFreeGradCache(pCache);
+        return NULL;
     }
 
-    prModel = (prLSmodel)malloc(sizeof(rLSmodel)*1);
-    if(prModel == NULL)
+    return pCache;
+}
+
+/* Refreshes the dimensions cached in the callback context and drops cached
+   function values, called before each solve since the model may have
+   changed since the callbacks were set */
+static void rSyncCbDims(prLSmodel prModel)
+{
+    rLindoData_t     *rudata = prModel->pCbData;
+    rLindoFunCache_t *pCache = rudata->pFunCache;
+    int              nVars = 0, nCons = 0;
+
+    LSgetInfo(prModel->pModel, LS_IINFO_NUM_VARS, &nVars);
+    LSgetInfo(prModel->pModel, LS_IINFO_NUM_CONS, &nCons);
+
+    if(pCache != NULL)
     {
-        return R_NilValue;
+        if(nVars != rudata->nVars || nCons != rudata->nCons)
+        {
+            rudata->pFunCache = rNewFunCache(pCache->nEntries, nVars, nCons);
+            rFreeFunCache(pCache);
+        }
+        else
+        {
+            memset(pCache->pbValid, 0, pCache->nEntries * sizeof(int));
+        }
     }
 
-    pModel = LScreateModel(pEnv,&nErrorCode);
-    if(nErrorCode)
+    if(rudata->pGradCache != NULL)
     {
-        Rprintf("Failed to create model object (error %d)\n",nErrorCode);
-        R_FlushConsole();
-        return R_NilValue;
+        if(nVars != rudata->pGradCache->nVars || nCons + 1 != rudata->pGradCache->nRows)
+        {
+            rFreeGradCache(rudata->pGradCache);
+            rudata->pGradCache = rNewGradCache(nVars, nCons);
+        }
+        else
+        {
+            rudata->pGradCache->bValid = FALSE;
+        }
     }
 
-    SET_PRINT_LOG(pModel,nErrorCode);
-    if(nErrorCode)
+    rudata->nVars = nVars;
+    rudata->nCons = nCons;
+}
+
+/* Returns the primal point as an R vector, refilling the vector kept in the
+   callback context when reuse is enabled */
+static SEXP rPrimalVector(rLindoData_t *rudata,
+                          double       *padPrimal)
+{
+    int  nVars = rudata->nVars;
+    SEXP spadPrimal;
+
+    if(!rudata->bReusePrimal)
     {
-        return R_NilValue;
+        spadPrimal = NEW_NUMERIC(nVars);
+        memcpy(NUMERIC_POINTER(spadPrimal), padPrimal, nVars * sizeof(double));
+        return spadPrimal;
     }
 
-    SET_MODEL_CALLBACK(pModel,nErrorCode);
-    if(nErrorCode)
+    if(rudata->sPrimalBuf == NULL || Rf_length(rudata->sPrimalBuf) != nVars)
     {
-        return R_NilValue;
+        PROTECT(spadPrimal = NEW_NUMERIC(nVars));
+        /* the callee must copy before modifying it */
+        MARK_NOT_MUTABLE(spadPrimal);
+        rSetCbSlot(&rudata->sPrimalBuf, spadPrimal);
+        UNPROTECT(1);
     }
 
-    prModel->pModel = pModel;
+    spadPrimal = rudata->sPrimalBuf;
+    memcpy(NUMERIC_POINTER(spadPrimal), padPrimal, nVars * sizeof(double));
 
-    sModel = R_MakeExternalPtr(prModel,R_NilValue,R_NilValue);
+    return spadPrimal;
+}
 
-    R_SetExternalPtrTag(sModel,tagLSprob);
+static void rFreeCbData(rLindoData_t *rudata)
+{
+    if(rudata == NULL)
+    {
+        return;
+    }
 
-    return sModel;
+    rSetCbSlot(&rudata->locFunc, R_NilValue);
+    rSetCbSlot(&rudata->locData, R_NilValue);
+    rSetCbSlot(&rudata->cbFunc, R_NilValue);
+    rSetCbSlot(&rudata->cbData, R_NilValue);
+    rSetCbSlot(&rudata->mipFunc, R_NilValue);
+    rSetCbSlot(&rudata->mipData, R_NilValue);
+    rSetCbSlot(&rudata->Funcalc_func, R_NilValue);
+    rSetCbSlot(&rudata->FData, R_NilValue);
+    rSetCbSlot(&rudata->Grad_func, R_NilValue);
+    rSetCbSlot(&rudata->Grad_func2, R_NilValue);
+    rSetCbSlot(&rudata->GData, R_NilValue);
+    rSetCbSlot(&rudata->Hessdc_func, R_NilValue);
+    rSetCbSlot(&rudata->HDCdata, R_NilValue);
+    rSetCbSlot(&rudata->sPrimalBuf, R_NilValue);
+    rFreeFunCache(rudata->pFunCache);
+    rFreeGradCache(rudata->pGradCache);
+    free(rudata);
 }
 
-SEXP rcLSdeleteEnv(SEXP sEnv)
+static void rFreeLogBuf(rLindoLogBuf_t *pLogBuf)
 {
-    prLSenv   prEnv;
-    pLSenv    pEnv;
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
-
-    //errorcode item
-    INI_ERR_CODE;
+    int k;
 
-    CHECK_ENV_ERROR;
+    if(pLogBuf == NULL)
+    {
+        return;
+    }
 
-    *pnErrorCode = LSdeleteEnv(&pEnv);
+    for(k = 0; k < pLogBuf->nCapacity; k++)
+        free(pLogBuf->paszLines[k]);
+    free(pLogBuf->paszLines);
+    free(pLogBuf);
+}
 
-    prEnv->pEnv = NULL;
+/* Env, model, sample and generator handles are released by explicit deletion
+   or by their finalizer, whichever comes first. An environment is kept alive
+   until its last model, sample and generator is released. */
+static int rFreeEnv(prLSenv prEnv)
+{
+    int nErrorCode;
 
-    R_ClearExternalPtr(sEnv);
+    nErrorCode = LSdeleteEnv(&prEnv->pEnv);
+    rFreeCbData(prEnv->pCbData);
+    free(prEnv);
 
-ErrorReturn:
-    //allocate list
-    SET_UP_LIST;
+    return nErrorCode;
+}
 
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    UNPROTECT(nProtect + 2);
+static int rReleaseEnv(prLSenv prEnv)
+{
+    prEnv->bReleased = 1;
+    if(prEnv->nRefs > 0)
+    {
+        return LSERR_NO_ERROR;
+    }
 
-    return rList;
+    return rFreeEnv(prEnv);
 }
 
-SEXP rcLSdeleteModel(SEXP sModel)
+static void rDropEnvRef(prLSenv prEnv)
 {
-    prLSmodel prModel;
-    pLSmodel  pModel;
+    if(prEnv == NULL)
+    {
+        return;
+    }
 
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    prEnv->nRefs--;
+    if(prEnv->bReleased && prEnv->nRefs == 0)
+    {
+        rFreeEnv(prEnv);
+    }
+}
 
-    //errorcode item
-    INI_ERR_CODE;
+static void rFreeNameIndex(rLindoNameIndex_t *pIndex)
+{
+    if(pIndex == NULL)
+    {
+        return;
+    }
 
-    CHECK_MODEL_ERROR;
+    free(pIndex->paiSlot);
+    free(pIndex->paiOffset);
+    free(pIndex->pachArena);
+    free(pIndex);
+}
 
-    *pnErrorCode = LSdeleteModel(&pModel);
+/* Drops the name lookup tables, called by every wrapper that may add, delete
+   or rename variables or constraints */
+static void rDropNameIndex(prLSmodel prModel)
+{
+    rFreeNameIndex(prModel->pVarIndex);
+    prModel->pVarIndex = NULL;
+    rFreeNameIndex(prModel->pConIndex);
+    prModel->pConIndex = NULL;
+}
 
-    prModel->pModel = NULL;
+static int rFreeModel(prLSmodel prModel)
+{
+    int nErrorCode = LSERR_NO_ERROR;
 
-    R_ClearExternalPtr(sModel);
+    if(prModel->pAsync != NULL)
+    {
+        rAsyncStop(prModel->pAsync);
+    }
 
-ErrorReturn:
-    //allocate list
-    SET_UP_LIST;
+    if(prModel->pModel != NULL)
+    {
+        nErrorCode = LSdeleteModel(&prModel->pModel);
+    }
 
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    UNPROTECT(nProtect + 2);
+    rFreeCbData(prModel->pCbData);
+    rFreeLogBuf(prModel->pLogBuf);
+    rDropNameIndex(prModel);
+    rDropEnvRef(prModel->prEnv);
+    free(prModel);
 
-    return rList;
+    return nErrorCode;
 }
 
-SEXP rcLScopyParam(SEXP ssourceModel,
-                   SEXP stargetModel,
-                   SEXP smSolverType)
+/* Wraps a new LINDO model created from prEnv, NULL when out of memory. Every
+   field of rLSmodel is set here. */
+static prLSmodel rNewModel(pLSmodel pModel, prLSenv prEnv)
 {
-    prLSmodel prsourceModel;
-    pLSmodel  sourceModel;
-    prLSmodel prtargetModel;
-    pLSmodel  targetModel;
-    int       mSolverType = Rf_asInteger(smSolverType);
-
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
-
-    //errorcode item
-    INI_ERR_CODE;
+    prLSmodel prModel = (prLSmodel)malloc(sizeof(rLSmodel)*1);
 
-    if(ssourceModel != R_NilValue && stargetModel != R_NilValue &&
-        R_ExternalPtrTag(ssourceModel) == tagLSprob &&
-        R_ExternalPtrTag(stargetModel) == tagLSprob)
-    {
-        prsourceModel = (prLSmodel)R_ExternalPtrAddr(ssourceModel);
-        prtargetModel = (prLSmodel)R_ExternalPtrAddr(stargetModel);
-        sourceModel = prsourceModel->pModel;
-        targetModel = prtargetModel->pModel;
-    }
-    else
+    if(prModel == NULL)
     {
-        *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;
-        goto ErrorReturn;
+        return NULL;
     }
 
-    *pnErrorCode = LScopyParam(sourceModel,targetModel,mSolverType);
-
-ErrorReturn:
-    //allocate list
-    SET_UP_LIST;
-
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    UNPROTECT(nProtect + 2);
+    prModel->pModel = pModel;
+    prModel->prEnv = prEnv;
+    prModel->pCbData = rNewCbData();
+    prModel->nCbIntervalMs = -1;
+    prModel->dLastEventsMs = 0;
+    prModel->pLogBuf = NULL;
+    prModel->pVarIndex = NULL;
+    prModel->pConIndex = NULL;
+    prModel->bLogOff = FALSE;
+    prModel->pAsync = NULL;
+    prEnv->nRefs++;
 
-    return rList;
+    return prModel;
 }
 
-/********************************************************
- * Model I-O Routines (18)                              *
- ********************************************************/
-SEXP rcLSreadMPSFile(SEXP sModel,
-                     SEXP spszFname,
-                     SEXP snFormat)
+static int rFreeSample(prLSsample prSample)
 {
-    prLSmodel prModel;
-    pLSmodel  pModel;
+    int nErrorCode = LSERR_NO_ERROR;
 
-    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
-    int       nFormat = Rf_asInteger(snFormat);
+    if(prSample->prEnv != NULL && prSample->pSample != NULL)
+    {
+        nErrorCode = LSsampDelete(&prSample->pSample);
+    }
 
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    rDropEnvRef(prSample->prEnv);
+    free(prSample);
 
-    //errorcode item
-    INI_ERR_CODE;
+    return nErrorCode;
+}
 
-    CHECK_MODEL_ERROR;
+static void rFreeRG(prLSrandGen prRG)
+{
+    if(prRG->pRG != NULL)
+    {
+        LSdisposeRG(&prRG->pRG);
+    }
 
-    *pnErrorCode = LSreadMPSFile(pModel,pszFname,nFormat);
+    rDropEnvRef(prRG->prEnv);
+    free(prRG);
+}
 
-ErrorReturn:
-    //allocate list
-    SET_UP_LIST;
+static void rFinalizeEnv(SEXP sEnv)
+{
+    prLSenv prEnv = (prLSenv)R_ExternalPtrAddr(sEnv);
 
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    UNPROTECT(nProtect + 2);
+    if(prEnv != NULL)
+    {
+        rReleaseEnv(prEnv);
+        R_ClearExternalPtr(sEnv);
+    }
+}
+
+static void rFinalizeModel(SEXP sModel)
+{
+    prLSmodel prModel = (prLSmodel)R_ExternalPtrAddr(sModel);
 
-    return rList;
+    if(prModel != NULL)
+    {
+        rFreeModel(prModel);
+        R_ClearExternalPtr(sModel);
+    }
 }
 
-SEXP rcLSwriteMPSFile(SEXP sModel,
-                      SEXP spszFname,
-                      SEXP snFormat)
+static void rFinalizeSample(SEXP sSample)
 {
-    prLSmodel prModel;
-    pLSmodel  pModel;
+    prLSsample prSample = (prLSsample)R_ExternalPtrAddr(sSample);
 
-    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
-    int       nFormat = Rf_asInteger(snFormat);
+    if(prSample != NULL)
+    {
+        rFreeSample(prSample);
+        R_ClearExternalPtr(sSample);
+    }
+}
 
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+static void rFinalizeRG(SEXP sRG)
+{
+    prLSrandGen prRG = (prLSrandGen)R_ExternalPtrAddr(sRG);
 
-    //errorcode item
-    INI_ERR_CODE;
+    if(prRG != NULL)
+    {
+        rFreeRG(prRG);
+        R_ClearExternalPtr(sRG);
+    }
+}
 
-    CHECK_MODEL_ERROR;
+static void LS_CALLTYPE rPrintLog(pLSmodel model,
+                                  char     *line,
+                                  void     *notting)
+{
+    Rprintf("%s",line);
+    R_FlushConsole();
+}
 
-    *pnErrorCode = LSwriteMPSFile(pModel,pszFname,nFormat);
+static double rMonotonicMs(void)
+{
+#ifdef _WIN32
+    return (double)GetTickCount64();
+#else
+    struct timespec ts;
 
-ErrorReturn:
-    //allocate list
-    SET_UP_LIST;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+#endif
+}
 
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    UNPROTECT(nProtect + 2);
+/* Minimal native thread layer. Code running on these threads must not
+   touch the R API. */
+#ifdef _WIN32
+typedef HANDLE rThread_t;
+typedef CRITICAL_SECTION rMutex_t;
+typedef DWORD (WINAPI *rThreadFn_t)(LPVOID);
+#define RTHREAD_FUNC(name) static DWORD WINAPI name(LPVOID pArg)
+#define RTHREAD_RETURN return 0
 
-    return rList;
+static int rThreadStart(rThread_t *pThread, rThreadFn_t fn, void *pArg)
+{
+    *pThread = CreateThread(NULL, 0, fn, pArg, 0, NULL);
+    return *pThread == NULL;
 }
 
-SEXP rcLSreadLINDOFile(SEXP sModel,
-                       SEXP spszFname)
+static void rThreadJoin(rThread_t thread)
 {
-    prLSmodel prModel;
-    pLSmodel  pModel;
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
 
-    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+#define rMutexInit(pm)    InitializeCriticalSection(pm)
+#define rMutexLock(pm)    EnterCriticalSection(pm)
+#define rMutexUnlock(pm)  LeaveCriticalSection(pm)
+#define rMutexDestroy(pm) DeleteCriticalSection(pm)
+#define rSleepMs(ms)      Sleep(ms)
+#else
+typedef pthread_t rThread_t;
+typedef pthread_mutex_t rMutex_t;
+typedef void *(*rThreadFn_t)(void*);
+#define RTHREAD_FUNC(name) static void *name(void *pArg)
+#define RTHREAD_RETURN return NULL
 
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+static int rThreadStart(rThread_t *pThread, rThreadFn_t fn, void *pArg)
+{
+    return pthread_create(pThread, NULL, fn, pArg);
+}
 
-    //errorcode item
-    INI_ERR_CODE;
+static void rThreadJoin(rThread_t thread)
+{
+    pthread_join(thread, NULL);
+}
 
-    CHECK_MODEL_ERROR;
+#define rMutexInit(pm)    pthread_mutex_init(pm, NULL)
+#define rMutexLock(pm)    pthread_mutex_lock(pm)
+#define rMutexUnlock(pm)  pthread_mutex_unlock(pm)
+#define rMutexDestroy(pm) pthread_mutex_destroy(pm)
 
-    *pnErrorCode = LSreadLINDOFile(pModel,pszFname);
+static void rSleepMs(int nMs)
+{
+    struct timespec ts;
 
-ErrorReturn:
-    //allocate list
-    SET_UP_LIST;
+    ts.tv_sec = nMs / 1000;
+    ts.tv_nsec = (long)(nMs % 1000) * 1000000L;
+    nanosleep(&ts, NULL);
+}
+#endif
 
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    UNPROTECT(nProtect + 2);
+int CALLBACKTYPE rCallBack(pLSmodel model,
+                           int      nLocation,
+                           void     *pData)
+{
+    prLSmodel prModel = (prLSmodel)pData;
+    double    dNow;
+
+    if(prModel != NULL && prModel->nCbIntervalMs > 0)
+    {
+        dNow = rMonotonicMs();
+        if(dNow - prModel->dLastEventsMs < prModel->nCbIntervalMs)
+        {
+            return 0;
+        }
+        prModel->dLastEventsMs = dNow;
+    }
 
-    return rList;
+    R_ProcessEvents();
+    return 0;
 }
 
-SEXP rcLSwriteLINDOFile(SEXP sModel,
-                        SEXP spszFname)
+/* Hands the pending lines to the model's log closure as one character
+   vector, or prints them with a single console flush */
+static void rFlushLogBuf(prLSmodel prModel)
 {
-    prLSmodel prModel;
-    pLSmodel  pModel;
+    rLindoLogBuf_t *pLogBuf = prModel->pLogBuf;
+    rLindoData_t   *rudata = prModel->pCbData;
+    int            nLines, nFirst, k;
+    SEXP           sLines, R_fcall;
 
-    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+    if(pLogBuf == NULL || pLogBuf->nPending == 0)
+    {
+        return;
+    }
 
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    nLines = pLogBuf->nPending < pLogBuf->nCount ? pLogBuf->nPending : pLogBuf->nCount;
+    nFirst = pLogBuf->nHead + pLogBuf->nCount - nLines;
+    pLogBuf->nPending = 0;
+    pLogBuf->dLastFlushMs = rMonotonicMs();
 
-    //errorcode item
-    INI_ERR_CODE;
+    if(rudata->locFunc != NULL)
+    {
+        PROTECT(sLines = NEW_CHARACTER(nLines));
+        for(k = 0; k < nLines; k++)
+            SET_STRING_ELT(sLines, k,
+                mkChar(pLogBuf->paszLines[(nFirst + k) % pLogBuf->nCapacity]));
 
-    CHECK_MODEL_ERROR;
+        PROTECT(R_fcall = lang4(rudata->locFunc, rudata->sModel, sLines,
+                                rudata->locData));
+        eval(R_fcall, R_GlobalEnv);
+        UNPROTECT(2);
+    }
+    else
+    {
+        for(k = 0; k < nLines; k++)
+            Rprintf("%s", pLogBuf->paszLines[(nFirst + k) % pLogBuf->nCapacity]);
+        R_FlushConsole();
+    }
+}
 
-    *pnErrorCode = LSwriteLINDOFile(pModel,pszFname);
+/* Stores a line in the ring without delivering it */
+static void rAppendLogLine(rLindoLogBuf_t *pLogBuf,
+                           char           *line)
+{
+    int iSlot;
 
-ErrorReturn:
-    //allocate list
-    SET_UP_LIST;
+    if(pLogBuf->nCount < pLogBuf->nCapacity)
+    {
+        iSlot = (pLogBuf->nHead + pLogBuf->nCount) % pLogBuf->nCapacity;
+        pLogBuf->nCount++;
+    }
+    else
+    {
+        iSlot = pLogBuf->nHead;
+        pLogBuf->nHead = (pLogBuf->nHead + 1) % pLogBuf->nCapacity;
+        free(pLogBuf->paszLines[iSlot]);
+    }
+    pLogBuf->paszLines[iSlot] = strdup(line);
+    pLogBuf->nPending++;
+}
 
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    UNPROTECT(nProtect + 2);
+static void LS_CALLTYPE rBufferLog(pLSmodel model,
+                                   char     *line,
+                                   void     *pData)
+{
+    prLSmodel      prModel = (prLSmodel)pData;
+    rLindoLogBuf_t *pLogBuf = prModel->pLogBuf;
 
-    return rList;
+    rAppendLogLine(pLogBuf, line);
+
+    if((pLogBuf->nBatch > 0 && pLogBuf->nPending >= pLogBuf->nBatch) ||
+       (pLogBuf->nIntervalMs > 0 &&
+        rMonotonicMs() - pLogBuf->dLastFlushMs >= pLogBuf->nIntervalMs))
+    {
+        rFlushLogBuf(prModel);
+    }
 }
 
-SEXP rcLSreadLINDOStream(SEXP sModel,
-                         SEXP spszStream,
-                         SEXP snStreamLen)
+int  CALLBACKTYPE rMipCallBack(pLSmodel model,
+                               void     *pvUserData,
+                               double   dObjval,
+                               double   *padPrimal)
 {
-    prLSmodel prModel;
-    pLSmodel  pModel;
+    return 0;
+}
 
-    char      *pszStream = (char *) CHAR(STRING_ELT(spszStream,0));
-    int       nStreamLen = Rf_asInteger(snStreamLen);
+/******************************************************
+ * Structure Creation and Deletion Routines (5)       *
+ ******************************************************/
+SEXP rcLScreateEnv()
+{
+    int      nErrorCode = LSERR_NO_ERROR;
+    char     MY_LICENSE_KEY[1024];
+    pLSenv   pEnv;
+    prLSenv  prEnv = NULL;
+    char     pachLicPath[256];
+    SEXP     sEnv = R_NilValue;
+
+    prEnv = (prLSenv)malloc(sizeof(rLSenv)*1);
+    if(prEnv == NULL)
+    {
+        return R_NilValue;
+    }
+
+    {
+      sprintf(pachLicPath, "%s//license//lndapi%d%d.lic", getenv("LINDOAPI_HOME"), LS_MAJOR_VER_NUMBER, LS_MINOR_VER_NUMBER);
+#if 0
+      fprintf(stdout, "Loading license file '%s'\n", pachLicPath); fflush(stdout);
+#endif
+      nErrorCode = LSloadLicenseString(pachLicPath, MY_LICENSE_KEY);
+      if (nErrorCode != LSERR_NO_ERROR)
+      {
+        Rprintf("Failed to load license key (error %d)\n", nErrorCode);
+        R_FlushConsole();
+        free(prEnv);
+        return R_NilValue;
+      }
+    }
+
+
+    pEnv = LScreateEnv(&nErrorCode, MY_LICENSE_KEY);
+    if(nErrorCode)
+    {
+        Rprintf("Failed to create enviroment object (error %d)\n",nErrorCode);
+        R_FlushConsole();
+        free(prEnv);
+        return R_NilValue;
+    }
+
+    prEnv->pEnv = pEnv;
+    prEnv->nRefs = 0;
+    prEnv->bReleased = 0;
+    prEnv->nLogHolds = 0;
+    prEnv->pCbData = rNewCbData();
+
+    PROTECT(sEnv = R_MakeExternalPtr(prEnv,R_NilValue,R_NilValue));
+
+    R_SetExternalPtrTag(sEnv,tagLSenv);
+
+    R_RegisterCFinalizerEx(sEnv,rFinalizeEnv,TRUE);
+
+    UNPROTECT(1);
+
+    return sEnv;
+}
+
+
+SEXP rcLScreateEnvByKey(SEXP slicenseKey)
+{
+  int      nErrorCode = LSERR_NO_ERROR;
+  char     MY_LICENSE_KEY[1024];
+  pLSenv   pEnv;
+  prLSenv  prEnv = NULL;
+  char     pachLicPath[256];
+  SEXP     sEnv = R_NilValue;
+  char* licenseKey = (char*)CHAR(STRING_ELT(slicenseKey, 0));
+
+  prEnv = (prLSenv)malloc(sizeof(rLSenv) * 1);
+  if (prEnv == NULL)
+  {
+    return R_NilValue;
+  }
+
+  if (!licenseKey) {
+    sprintf(pachLicPath, "%s//license//lndapi%d%d.lic", getenv("LINDOAPI_HOME"), LS_MAJOR_VER_NUMBER, LS_MINOR_VER_NUMBER);
+#if 0
+    fprintf(stdout, "Loading license file '%s'\n", pachLicPath); fflush(stdout);
+#endif
+    nErrorCode = LSloadLicenseString(pachLicPath, MY_LICENSE_KEY);
+    if (nErrorCode != LSERR_NO_ERROR)
+    {
+      Rprintf("Failed to load license key (error %d)\n", nErrorCode);
+      R_FlushConsole();
+      free(prEnv);
+      return R_NilValue;
+    }
+  }
+  else {
+    strncpy(MY_LICENSE_KEY, licenseKey, 1024-1);
+  }
+
+
+  pEnv = LScreateEnv(&nErrorCode, MY_LICENSE_KEY);
+  if (nErrorCode)
+  {
+    Rprintf("Failed to create enviroment object (error %d)\n", nErrorCode);
+    R_FlushConsole();
+    free(prEnv);
+    return R_NilValue;
+  }
+
+  prEnv->pEnv = pEnv;
+  prEnv->nRefs = 0;
+  prEnv->bReleased = 0;
+  prEnv->nLogHolds = 0;
+  prEnv->pCbData = rNewCbData();
+
+  PROTECT(sEnv = R_MakeExternalPtr(prEnv, R_NilValue, R_NilValue));
+
+  R_SetExternalPtrTag(sEnv, tagLSenv);
+
+  R_RegisterCFinalizerEx(sEnv, rFinalizeEnv, TRUE);
+
+  UNPROTECT(1);
+
+  return sEnv;
+}
+
+
+SEXP rcLScreateModel(SEXP sEnv)
+{
+    int       nErrorCode = LSERR_NO_ERROR;
+    prLSenv   prEnv = NULL;
+    pLSenv    pEnv = NULL;
+    prLSmodel prModel = NULL;
+    pLSmodel  pModel = NULL;
+    SEXP      sModel = R_NilValue;
+
+    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv)
+    {
+        prEnv = (prLSenv)R_ExternalPtrAddr(sEnv);
+        if(prEnv == NULL)
+        {
+            nErrorCode = LSERR_ILLEGAL_NULL_POINTER;
+            Rprintf("Failed to create model object (error %d)\n",nErrorCode);
+            R_FlushConsole();
+            return R_NilValue;
+        }
+        pEnv = prEnv->pEnv;
+    }
+    else
+    {
+        nErrorCode = LSERR_ILLEGAL_NULL_POINTER;
+        Rprintf("Failed to create model object (error %d)\n",nErrorCode);
+        R_FlushConsole();
+        return R_NilValue;
+    }
+
+    pModel = LScreateModel(pEnv,&nErrorCode);
+    if(nErrorCode)
+    {
+        Rprintf("Failed to create model object (error %d)\n",nErrorCode);
+        R_FlushConsole();
+        return R_NilValue;
+    }
+
+    prModel = rNewModel(pModel,prEnv);
+    if(prModel == NULL)
+    {
+        LSdeleteModel(&pModel);
+        return R_NilValue;
+    }
+
+    SET_PRINT_LOG(pModel,nErrorCode);
+    if(nErrorCode)
+    {
+        rFreeModel(prModel);
+        return R_NilValue;
+    }
+
+    SET_MODEL_CALLBACK(pModel,prModel,nErrorCode);
+    if(nErrorCode)
+    {
+        rFreeModel(prModel);
+        return R_NilValue;
+    }
 
+    PROTECT(sModel = R_MakeExternalPtr(prModel,R_NilValue,sEnv));
+
+    R_SetExternalPtrTag(sModel,tagLSprob);
+
+    R_RegisterCFinalizerEx(sModel,rFinalizeModel,TRUE);
+
+    UNPROTECT(1);
+
+    return sModel;
+}
+
+SEXP rcLSdeleteEnv(SEXP sEnv)
+{
+    prLSenv   prEnv;
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_MODEL_ERROR;
+    //deleting an already deleted env is not an error
+    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv &&
+       R_ExternalPtrAddr(sEnv) == NULL)
+    {
+        goto ErrorReturn;
+    }
 
-    *pnErrorCode = LSreadLINDOStream(pModel,pszStream,nStreamLen);
+    CHECK_ENV_HANDLE;
+
+    //the env itself is deleted once its last model is released
+    *pnErrorCode = rReleaseEnv(prEnv);
+
+    R_ClearExternalPtr(sEnv);
 
 ErrorReturn:
     //allocate list
@@ -693,16 +1164,12 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteLINGOFile(SEXP sModel,
-                        SEXP spszFname)
+SEXP rcLSdeleteModel(SEXP sModel)
 {
     prLSmodel prModel;
-    pLSmodel  pModel;
-
-    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -710,14 +1177,23 @@ SEXP rcLSwriteLINGOFile(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_MODEL_ERROR;
+    //deleting an already deleted model is not an error
+    if(sModel != R_NilValue && R_ExternalPtrTag(sModel) == tagLSprob &&
+       R_ExternalPtrAddr(sModel) == NULL)
+    {
+        goto ErrorReturn;
+    }
 
-    *pnErrorCode = LSwriteLINGOFile(pModel,pszFname);
+    CHECK_MODEL_HANDLE;
+
+    *pnErrorCode = rFreeModel(prModel);
+
+    R_ClearExternalPtr(sModel);
 
 ErrorReturn:
     //allocate list
@@ -726,20 +1202,18 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteDualMPSFile(SEXP sModel,
-                          SEXP spszFname,
-                          SEXP snFormat,
-                          SEXP snObjSense)
+SEXP rcLScopyParam(SEXP ssourceModel,
+                   SEXP stargetModel,
+                   SEXP smSolverType)
 {
-    prLSmodel prModel;
-    pLSmodel  pModel;
-
-    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
-    int       nFormat = Rf_asInteger(snFormat);
-    int       nObjSense = Rf_asInteger(snObjSense);
+    prLSmodel prsourceModel;
+    pLSmodel  sourceModel;
+    prLSmodel prtargetModel;
+    pLSmodel  targetModel;
+    int       mSolverType = Rf_asInteger(smSolverType);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -747,14 +1221,27 @@ SEXP rcLSwriteDualMPSFile(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_MODEL_ERROR;
+    if(ssourceModel != R_NilValue && stargetModel != R_NilValue &&
+        R_ExternalPtrTag(ssourceModel) == tagLSprob &&
+        R_ExternalPtrTag(stargetModel) == tagLSprob)
+    {
+        prsourceModel = (prLSmodel)R_ExternalPtrAddr(ssourceModel);
+        prtargetModel = (prLSmodel)R_ExternalPtrAddr(stargetModel);
+        sourceModel = prsourceModel->pModel;
+        targetModel = prtargetModel->pModel;
+    }
+    else
+    {
+        *pnErrorCode = LSERR_ILLEGAL_NULL_POINTER;
+        goto ErrorReturn;
+    }
 
-    *pnErrorCode = LSwriteDualMPSFile(pModel,pszFname,nFormat,nObjSense);
+    *pnErrorCode = LScopyParam(sourceModel,targetModel,mSolverType);
 
 ErrorReturn:
     //allocate list
@@ -763,16 +1250,21 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteSolution(SEXP sModel,
-                       SEXP spszFname)
+/********************************************************
+ * Model I-O Routines (18)                              *
+ ********************************************************/
+SEXP rcLSreadMPSFile(SEXP sModel,
+                     SEXP spszFname,
+                     SEXP snFormat)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
 
     char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+    int       nFormat = Rf_asInteger(snFormat);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -780,14 +1272,16 @@ SEXP rcLSwriteSolution(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSwriteSolution(pModel,pszFname);
+    rDropNameIndex(prModel);
+
+    *pnErrorCode = LSreadMPSFile(pModel,pszFname,nFormat);
 
 ErrorReturn:
     //allocate list
@@ -796,12 +1290,12 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteSolutionOfType(SEXP sModel,
-                             SEXP spszFname,
-                             SEXP snFormat)
+SEXP rcLSwriteMPSFile(SEXP sModel,
+                      SEXP spszFname,
+                      SEXP snFormat)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
@@ -815,14 +1309,14 @@ SEXP rcLSwriteSolutionOfType(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSwriteSolutionOfType(pModel,pszFname,nFormat);
+    *pnErrorCode = LSwriteMPSFile(pModel,pszFname,nFormat);
 
 ErrorReturn:
     //allocate list
@@ -831,11 +1325,11 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteIIS(SEXP sModel,
-                  SEXP spszFname)
+SEXP rcLSreadLINDOFile(SEXP sModel,
+                       SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
@@ -848,14 +1342,16 @@ SEXP rcLSwriteIIS(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSwriteIIS(pModel,pszFname);
+    rDropNameIndex(prModel);
+
+    *pnErrorCode = LSreadLINDOFile(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
@@ -864,11 +1360,11 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteIUS(SEXP sModel,
-                  SEXP spszFname)
+SEXP rcLSwriteLINDOFile(SEXP sModel,
+                        SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
@@ -881,14 +1377,14 @@ SEXP rcLSwriteIUS(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSwriteIUS(pModel,pszFname);
+    *pnErrorCode = LSwriteLINDOFile(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
@@ -897,16 +1393,18 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSreadMPIFile(SEXP sModel,
-                     SEXP spszFname)
+SEXP rcLSreadLINDOStream(SEXP sModel,
+                         SEXP spszStream,
+                         SEXP snStreamLen)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
 
-    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+    char      *pszStream = (char *) CHAR(STRING_ELT(spszStream,0));
+    int       nStreamLen = Rf_asInteger(snStreamLen);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -914,14 +1412,16 @@ SEXP rcLSreadMPIFile(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSreadMPIFile(pModel,pszFname);
+    rDropNameIndex(prModel);
+
+    *pnErrorCode = LSreadLINDOStream(pModel,pszStream,nStreamLen);
 
 ErrorReturn:
     //allocate list
@@ -930,11 +1430,11 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteMPIFile(SEXP sModel,
-                      SEXP spszFname)
+SEXP rcLSwriteLINGOFile(SEXP sModel,
+                        SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
@@ -947,14 +1447,14 @@ SEXP rcLSwriteMPIFile(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSwriteMPIFile(pModel,pszFname);
+    *pnErrorCode = LSwriteLINGOFile(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
@@ -963,18 +1463,20 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteWithSetsAndSC(SEXP sModel,
-                            SEXP spszFname,
-                            SEXP snFormat)
+SEXP rcLSwriteDualMPSFile(SEXP sModel,
+                          SEXP spszFname,
+                          SEXP snFormat,
+                          SEXP snObjSense)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
 
     char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
     int       nFormat = Rf_asInteger(snFormat);
+    int       nObjSense = Rf_asInteger(snObjSense);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -982,14 +1484,14 @@ SEXP rcLSwriteWithSetsAndSC(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSwriteWithSetsAndSC(pModel,pszFname,nFormat);
+    *pnErrorCode = LSwriteDualMPSFile(pModel,pszFname,nFormat,nObjSense);
 
 ErrorReturn:
     //allocate list
@@ -998,18 +1500,16 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSreadBasis(SEXP sModel,
-                   SEXP spszFname,
-                   SEXP snFormat)
+SEXP rcLSwriteSolution(SEXP sModel,
+                       SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
 
     char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
-    int       nFormat = Rf_asInteger(snFormat);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -1017,14 +1517,14 @@ SEXP rcLSreadBasis(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSreadBasis(pModel,pszFname,nFormat);
+    *pnErrorCode = LSwriteSolution(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
@@ -1033,13 +1533,12 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSwriteBasis(SEXP sModel,
-                    SEXP spszFname,
-                    SEXP snFormat)
+SEXP rcLSwriteSolutionOfType(SEXP sModel,
+                             SEXP spszFname,
+                             SEXP snFormat)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
@@ -1053,14 +1552,14 @@ SEXP rcLSwriteBasis(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSwriteBasis(pModel,pszFname,nFormat);
+    *pnErrorCode = LSwriteSolutionOfType(pModel,pszFname,nFormat);
 
 ErrorReturn:
     //allocate list
@@ -1069,12 +1568,11 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSreadLPFile(SEXP sModel,
-                    SEXP spszFname)
+SEXP rcLSwriteIIS(SEXP sModel,
+                  SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
@@ -1087,36 +1585,32 @@ SEXP rcLSreadLPFile(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSreadLPFile(pModel,pszFname);
+    *pnErrorCode = LSwriteIIS(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
-
     UNPROTECT(nProtect + 2);
 
-
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSreadLPStream(SEXP sModel,
-                      SEXP spszStream,
-                      SEXP snStreamLen)
+SEXP rcLSwriteIUS(SEXP sModel,
+                  SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
 
-    char      *pszStream = (char *) CHAR(STRING_ELT(spszStream,0));
-    int       nStreamLen = Rf_asInteger(snStreamLen);
+    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -1124,29 +1618,27 @@ SEXP rcLSreadLPStream(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSreadLPStream(pModel,pszStream,nStreamLen);
+    *pnErrorCode = LSwriteIUS(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
-
     UNPROTECT(nProtect + 2);
 
-
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSreadSDPAFile(SEXP sModel,
-                      SEXP spszFname)
+SEXP rcLSreadMPIFile(SEXP sModel,
+                     SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
@@ -1159,227 +1651,174 @@ SEXP rcLSreadSDPAFile(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSreadSDPAFile(pModel,pszFname);
+    rDropNameIndex(prModel);
+
+    *pnErrorCode = LSreadMPIFile(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
-
     UNPROTECT(nProtect + 2);
 
-
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSsetPrintLogNull(SEXP sModel)
+SEXP rcLSwriteMPIFile(SEXP sModel,
+                      SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
 
+    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    SET_PRINT_LOG_NULL(pModel,*pnErrorCode);
+    *pnErrorCode = LSwriteMPIFile(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
-
     UNPROTECT(nProtect + 2);
 
-
-    return rList;
+    return rReturnList(rList);
 }
 
-/********************************************************
- * Error Handling Routines (3)                          *
- ********************************************************/
-SEXP rcLSgetErrorMessage(SEXP   sEnv,
-                         SEXP   snErrorCode)
+SEXP rcLSwriteWithSetsAndSC(SEXP sModel,
+                            SEXP spszFname,
+                            SEXP snFormat)
 {
-    prLSenv       prEnv;
-    pLSenv        pEnv;
-    int           nErrorCode = Rf_asInteger(snErrorCode);
+    prLSmodel prModel;
+    pLSmodel  pModel;
 
-    int           *pnErrorCode;
-    SEXP          spnErrorCode = R_NilValue;
-    char          pachMessage[LS_MAX_ERROR_MESSAGE_LENGTH];
-    SEXP          spachMessage = R_NilValue;
-    SEXP          rList = R_NilValue;
-    char          *Names[2] = {"ErrorCode", "pachMessage"};
-    SEXP          ListNames = R_NilValue;
-    int           nNumItems = 2;
-    int           nIdx, nProtect = 0;
+    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+    int       nFormat = Rf_asInteger(snFormat);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_ENV_ERROR;
-
-    //description item
-    PROTECT(spachMessage = NEW_CHARACTER(1));
-    nProtect += 1;
-
-    *pnErrorCode = LSgetErrorMessage(pEnv,nErrorCode,pachMessage);
-
-    CHECK_ERRCODE;
+    CHECK_MODEL_ERROR;
 
-    SET_STRING_ELT(spachMessage,0,mkChar(pachMessage));
+    *pnErrorCode = LSwriteWithSetsAndSC(pModel,pszFname,nFormat);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
-    if(*pnErrorCode != LSERR_NO_ERROR)
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    }
-    else
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-        SET_VECTOR_ELT(rList, 1, spachMessage);
-    }
-
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSgetFileError(SEXP sModel)
+SEXP rcLSreadBasis(SEXP sModel,
+                   SEXP spszFname,
+                   SEXP snFormat)
 {
-    prLSmodel     prModel;
-    pLSmodel      pModel;
+    prLSmodel prModel;
+    pLSmodel  pModel;
 
-    int           *pnErrorCode;
-    SEXP          spnErrorCode = R_NilValue;
-    char          pachLinetxt[256];
-    SEXP          spachLinetxt = R_NilValue;
-    int           *pnLinenum;
-    SEXP          spnLinenum = R_NilValue;
-    SEXP          rList = R_NilValue;
-    char          *Names[3] = {"ErrorCode", "pnLinenum", "pachLinetxt"};
-    SEXP          ListNames = R_NilValue;
-    int           nNumItems = 3;
-    int           nIdx, nProtect = 0;
+    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+    int       nFormat = Rf_asInteger(snFormat);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    PROTECT(spnLinenum = NEW_INTEGER(1));
-    nProtect += 1;
-    pnLinenum = INTEGER_POINTER(spnLinenum);
-
-    //description item
-    PROTECT(spachLinetxt = NEW_CHARACTER(1));
-    nProtect += 1;
-
-    *pnErrorCode = LSgetFileError(pModel,pnLinenum,pachLinetxt);
-
-    CHECK_ERRCODE;
-
-    SET_STRING_ELT(spachLinetxt,0,mkChar(pachLinetxt));
+    *pnErrorCode = LSreadBasis(pModel,pszFname,nFormat);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
-    if(*pnErrorCode != LSERR_NO_ERROR)
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    }
-    else
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-        SET_VECTOR_ELT(rList, 1, spnLinenum);
-        SET_VECTOR_ELT(rList, 2, spachLinetxt);
-    }
-
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSgetErrorRowIndex(SEXP sModel)
+SEXP rcLSwriteBasis(SEXP sModel,
+                    SEXP spszFname,
+                    SEXP snFormat)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
 
+    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
+    int       nFormat = Rf_asInteger(snFormat);
+
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    int       *piRow;
-    SEXP      spiRow = R_NilValue;
     SEXP      rList = R_NilValue;
-    char      *Names[2] = {"ErrorCode", "piRow"};
+    char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
-    int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nNumItems = 1;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    PROTECT(spiRow = NEW_INTEGER(1));
-    nProtect += 1;
-    piRow = INTEGER_POINTER(spiRow);
-
-    *pnErrorCode = LSgetErrorRowIndex(pModel,piRow);
+    *pnErrorCode = LSwriteBasis(pModel,pszFname,nFormat);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
-    if(*pnErrorCode != LSERR_NO_ERROR)
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    }
-    else
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-        SET_VECTOR_ELT(rList, 1, spiRow);
-    }
-
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+
+    return rReturnList(rList);
 }
 
-/***********************************************************
- * Routines for Setting and Retrieving Parameter Values(17)*
- ***********************************************************/
-SEXP rcLSsetModelDouParameter(SEXP sModel,
-                              SEXP snParameter,
-                              SEXP sdValue)
+SEXP rcLSreadLPFile(SEXP sModel,
+                    SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
-    int       nParameter = Rf_asInteger(snParameter);
-    double    dValue = Rf_asReal(sdValue);
+
+    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -1387,80 +1826,75 @@ SEXP rcLSsetModelDouParameter(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSsetModelDouParameter(pModel,nParameter,dValue);
+    rDropNameIndex(prModel);
+
+    *pnErrorCode = LSreadLPFile(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
+
     UNPROTECT(nProtect + 2);
 
-    return rList;
+
+    return rReturnList(rList);
 }
 
-SEXP rcLSgetModelDouParameter(SEXP sModel,
-                              SEXP snParameter)
+SEXP rcLSreadLPStream(SEXP sModel,
+                      SEXP spszStream,
+                      SEXP snStreamLen)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
-    int       nParameter = Rf_asInteger(snParameter);
+
+    char      *pszStream = (char *) CHAR(STRING_ELT(spszStream,0));
+    int       nStreamLen = Rf_asInteger(snStreamLen);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    double    *pdValue;
-    SEXP      spdValue = R_NilValue;
     SEXP      rList = R_NilValue;
-    char      *Names[2] = {"ErrorCode", "pdValue"};
+    char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
-    int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nNumItems = 1;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    PROTECT(spdValue = NEW_NUMERIC(1));
-    nProtect += 1;
-    pdValue = NUMERIC_POINTER(spdValue);
+    rDropNameIndex(prModel);
 
-    *pnErrorCode = LSgetModelDouParameter(pModel,nParameter,pdValue);
+    *pnErrorCode = LSreadLPStream(pModel,pszStream,nStreamLen);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
-    if(*pnErrorCode != LSERR_NO_ERROR)
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-    }
-    else
-    {
-        SET_VECTOR_ELT(rList, 0, spnErrorCode);
-        SET_VECTOR_ELT(rList, 1, spdValue);
-    }
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+
+    return rReturnList(rList);
 }
 
-SEXP rcLSsetModelIntParameter(SEXP sModel,
-                              SEXP snParameter,
-                              SEXP snValue)
+SEXP rcLSreadSDPAFile(SEXP sModel,
+                      SEXP spszFname)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
-    int       nParameter = Rf_asInteger(snParameter);
-    int       nValue = Rf_asInteger(snValue);
+
+    char      *pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -1468,52 +1902,98 @@ SEXP rcLSsetModelIntParameter(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSsetModelIntParameter(pModel,nParameter,nValue);
+    rDropNameIndex(prModel);
+
+    *pnErrorCode = LSreadSDPAFile(pModel,pszFname);
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
+
     UNPROTECT(nProtect + 2);
 
-    return rList;
+
+    return rReturnList(rList);
 }
 
-SEXP rcLSgetModelIntParameter(SEXP sModel,
-                              SEXP snParameter)
+SEXP rcLSsetPrintLogNull(SEXP sModel)
 {
     prLSmodel prModel;
     pLSmodel  pModel;
-    int       nParameter = Rf_asInteger(snParameter);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    int       *pnValue;
-    SEXP      spnValue = R_NilValue;
     SEXP      rList = R_NilValue;
-    char      *Names[2] = {"ErrorCode", "pnValue"};
+    char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
-    int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nNumItems = 1;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
-    PROTECT(spnValue = NEW_INTEGER(1));
+    SET_PRINT_LOG_NULL(pModel,*pnErrorCode);
+    prModel->bLogOff = TRUE;
+    rSetCbSlot(&prModel->pCbData->locFunc, R_NilValue);
+    rSetCbSlot(&prModel->pCbData->locData, R_NilValue);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+
+    UNPROTECT(nProtect + 2);
+
+
+    return rReturnList(rList);
+}
+
+/********************************************************
+ * Error Handling Routines (3)                          *
+ ********************************************************/
+SEXP rcLSgetErrorMessage(SEXP   sEnv,
+                         SEXP   snErrorCode)
+{
+    prLSenv       prEnv;
+    pLSenv        pEnv;
+    int           nErrorCode = Rf_asInteger(snErrorCode);
+
+    int           *pnErrorCode;
+    SEXP          spnErrorCode = R_NilValue;
+    char          pachMessage[LS_MAX_ERROR_MESSAGE_LENGTH];
+    SEXP          spachMessage = R_NilValue;
+    SEXP          rList = R_NilValue;
+    char          *Names[2] = {"ErrorCode", "pachMessage"};
+    SEXP          ListNames = R_NilValue;
+    int           nNumItems = 2;
+    int           nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ENV_ERROR;
+
+    //description item
+    PROTECT(spachMessage = NEW_CHARACTER(1));
     nProtect += 1;
-    pnValue = INTEGER_POINTER(spnValue);
 
-    *pnErrorCode = LSgetModelIntParameter(pModel,nParameter,pnValue);
+    *pnErrorCode = LSgetErrorMessage(pEnv,nErrorCode,pachMessage);
+
+    CHECK_ERRCODE;
+
+    SET_STRING_ELT(spachMessage,0,mkChar(pachMessage));
 
 ErrorReturn:
     //allocate list
@@ -1526,75 +2006,97 @@ ErrorReturn:
     else
     {
         SET_VECTOR_ELT(rList, 0, spnErrorCode);
-        SET_VECTOR_ELT(rList, 1, spnValue);
+        SET_VECTOR_ELT(rList, 1, spachMessage);
     }
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+
+    return rReturnList(rList);
 }
 
-SEXP rcLSsetEnvDouParameter(SEXP sEnv,
-                            SEXP snParameter,
-                            SEXP sdValue)
+SEXP rcLSgetFileError(SEXP sModel)
 {
-    prLSenv   prEnv;
-    pLSenv    pEnv;
-    int       nParameter = Rf_asInteger(snParameter);
-    double    dValue = Rf_asReal(sdValue);
+    prLSmodel     prModel;
+    pLSmodel      pModel;
 
-    int       *pnErrorCode;
-    SEXP      spnErrorCode = R_NilValue;
-    SEXP      rList = R_NilValue;
-    char      *Names[1] = {"ErrorCode"};
-    SEXP      ListNames = R_NilValue;
-    int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int           *pnErrorCode;
+    SEXP          spnErrorCode = R_NilValue;
+    char          pachLinetxt[256];
+    SEXP          spachLinetxt = R_NilValue;
+    int           *pnLinenum;
+    SEXP          spnLinenum = R_NilValue;
+    SEXP          rList = R_NilValue;
+    char          *Names[3] = {"ErrorCode", "pnLinenum", "pachLinetxt"};
+    SEXP          ListNames = R_NilValue;
+    int           nNumItems = 3;
+    int           nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_ENV_ERROR;
+    CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSsetEnvDouParameter(pEnv,nParameter,dValue);
+    PROTECT(spnLinenum = NEW_INTEGER(1));
+    nProtect += 1;
+    pnLinenum = INTEGER_POINTER(spnLinenum);
+
+    //description item
+    PROTECT(spachLinetxt = NEW_CHARACTER(1));
+    nProtect += 1;
+
+    *pnErrorCode = LSgetFileError(pModel,pnLinenum,pachLinetxt);
+
+    CHECK_ERRCODE;
+
+    SET_STRING_ELT(spachLinetxt,0,mkChar(pachLinetxt));
 
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
 
-    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spnLinenum);
+        SET_VECTOR_ELT(rList, 2, spachLinetxt);
+    }
+
     UNPROTECT(nProtect + 2);
 
-    return rList;
+
+    return rReturnList(rList);
 }
 
-SEXP rcLSgetEnvDouParameter(SEXP sEnv,
-                            SEXP snParameter)
+SEXP rcLSgetErrorRowIndex(SEXP sModel)
 {
-    prLSenv   prEnv;
-    pLSenv    pEnv;
-    int       nParameter = Rf_asInteger(snParameter);
+    prLSmodel prModel;
+    pLSmodel  pModel;
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    double    *pdValue;
-    SEXP      spdValue = R_NilValue;
+    int       *piRow;
+    SEXP      spiRow = R_NilValue;
     SEXP      rList = R_NilValue;
-    char      *Names[2] = {"ErrorCode", "pdValue"};
+    char      *Names[2] = {"ErrorCode", "piRow"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_ENV_ERROR;
+    CHECK_MODEL_ERROR;
 
-    PROTECT(spdValue = NEW_NUMERIC(1));
+    PROTECT(spiRow = NEW_INTEGER(1));
     nProtect += 1;
-    pdValue = NUMERIC_POINTER(spdValue);
+    piRow = INTEGER_POINTER(spiRow);
 
-    *pnErrorCode = LSgetEnvDouParameter(pEnv,nParameter,pdValue);
+    *pnErrorCode = LSgetErrorRowIndex(pModel,piRow);
 
 ErrorReturn:
     //allocate list
@@ -1607,22 +2109,25 @@ ErrorReturn:
     else
     {
         SET_VECTOR_ELT(rList, 0, spnErrorCode);
-        SET_VECTOR_ELT(rList, 1, spdValue);
+        SET_VECTOR_ELT(rList, 1, spiRow);
     }
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSsetEnvIntParameter(SEXP sEnv,
-                            SEXP snParameter,
-                            SEXP snValue)
+/***********************************************************
+ * Routines for Setting and Retrieving Parameter Values(17)*
+ ***********************************************************/
+SEXP rcLSsetModelDouParameter(SEXP sModel,
+                              SEXP snParameter,
+                              SEXP sdValue)
 {
-    prLSenv   prEnv;
-    pLSenv    pEnv;
+    prLSmodel prModel;
+    pLSmodel  pModel;
     int       nParameter = Rf_asInteger(snParameter);
-    int       nValue = Rf_asInteger(snValue);
+    double    dValue = Rf_asReal(sdValue);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -1630,14 +2135,14 @@ SEXP rcLSsetEnvIntParameter(SEXP sEnv,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_ENV_ERROR;
+    CHECK_MODEL_ERROR;
 
-    *pnErrorCode = LSsetEnvIntParameter(pEnv,nParameter,nValue);
+    *pnErrorCode = LSsetModelDouParameter(pModel,nParameter,dValue);
 
 ErrorReturn:
     //allocate list
@@ -1646,25 +2151,268 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
-SEXP rcLSgetEnvIntParameter(SEXP sEnv,
-                            SEXP snParameter)
+SEXP rcLSgetModelDouParameter(SEXP sModel,
+                              SEXP snParameter)
 {
-    prLSenv   prEnv;
-    pLSenv    pEnv;
+    prLSmodel prModel;
+    pLSmodel  pModel;
     int       nParameter = Rf_asInteger(snParameter);
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    int       *pnValue;
-    SEXP      spnValue = R_NilValue;
+    double    *pdValue;
+    SEXP      spdValue = R_NilValue;
     SEXP      rList = R_NilValue;
-    char      *Names[2] = {"ErrorCode", "pnValue"};
+    char      *Names[2] = {"ErrorCode", "pdValue"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    PROTECT(spdValue = NEW_NUMERIC(1));
+    nProtect += 1;
+    pdValue = NUMERIC_POINTER(spdValue);
+
+    *pnErrorCode = LSgetModelDouParameter(pModel,nParameter,pdValue);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spdValue);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+SEXP rcLSsetModelIntParameter(SEXP sModel,
+                              SEXP snParameter,
+                              SEXP snValue)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nParameter = Rf_asInteger(snParameter);
+    int       nValue = Rf_asInteger(snValue);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    *pnErrorCode = LSsetModelIntParameter(pModel,nParameter,nValue);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+SEXP rcLSgetModelIntParameter(SEXP sModel,
+                              SEXP snParameter)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nParameter = Rf_asInteger(snParameter);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    int       *pnValue;
+    SEXP      spnValue = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "pnValue"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    PROTECT(spnValue = NEW_INTEGER(1));
+    nProtect += 1;
+    pnValue = INTEGER_POINTER(spnValue);
+
+    *pnErrorCode = LSgetModelIntParameter(pModel,nParameter,pnValue);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spnValue);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+SEXP rcLSsetEnvDouParameter(SEXP sEnv,
+                            SEXP snParameter,
+                            SEXP sdValue)
+{
+    prLSenv   prEnv;
+    pLSenv    pEnv;
+    int       nParameter = Rf_asInteger(snParameter);
+    double    dValue = Rf_asReal(sdValue);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ENV_ERROR;
+
+    *pnErrorCode = LSsetEnvDouParameter(pEnv,nParameter,dValue);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+SEXP rcLSgetEnvDouParameter(SEXP sEnv,
+                            SEXP snParameter)
+{
+    prLSenv   prEnv;
+    pLSenv    pEnv;
+    int       nParameter = Rf_asInteger(snParameter);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    double    *pdValue;
+    SEXP      spdValue = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "pdValue"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ENV_ERROR;
+
+    PROTECT(spdValue = NEW_NUMERIC(1));
+    nProtect += 1;
+    pdValue = NUMERIC_POINTER(spdValue);
+
+    *pnErrorCode = LSgetEnvDouParameter(pEnv,nParameter,pdValue);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spdValue);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+SEXP rcLSsetEnvIntParameter(SEXP sEnv,
+                            SEXP snParameter,
+                            SEXP snValue)
+{
+    prLSenv   prEnv;
+    pLSenv    pEnv;
+    int       nParameter = Rf_asInteger(snParameter);
+    int       nValue = Rf_asInteger(snValue);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ENV_ERROR;
+
+    *pnErrorCode = LSsetEnvIntParameter(pEnv,nParameter,nValue);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+SEXP rcLSgetEnvIntParameter(SEXP sEnv,
+                            SEXP snParameter)
+{
+    prLSenv   prEnv;
+    pLSenv    pEnv;
+    int       nParameter = Rf_asInteger(snParameter);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    int       *pnValue;
+    SEXP      spnValue = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "pnValue"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -1693,7 +2441,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSreadModelParameter(SEXP sModel,
@@ -1710,7 +2458,7 @@ SEXP rcLSreadModelParameter(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -1726,7 +2474,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSreadEnvParameter(SEXP sEnv,
@@ -1742,7 +2490,7 @@ SEXP rcLSreadEnvParameter(SEXP sEnv,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -1758,7 +2506,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteModelParameter(SEXP sModel,
@@ -1775,7 +2523,7 @@ SEXP rcLSwriteModelParameter(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -1791,7 +2539,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetIntParameterRange(SEXP sModel,
@@ -1811,7 +2559,7 @@ SEXP rcLSgetIntParameterRange(SEXP sModel,
     char      *Names[3] = {"ErrorCode", "pnValMIN", "pnValMAX"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -1845,7 +2593,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDouParameterRange(SEXP sModel,
@@ -1865,7 +2613,7 @@ SEXP rcLSgetDouParameterRange(SEXP sModel,
     char      *Names[3] = {"ErrorCode", "pdValMIN", "pdValMAX"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -1899,7 +2647,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetParamShortDesc(SEXP sEnv,
@@ -1917,7 +2665,7 @@ SEXP rcLSgetParamShortDesc(SEXP sEnv,
     char      *Names[2] = {"ErrorCode", "szDescription"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -1955,7 +2703,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetParamLongDesc(SEXP sEnv,
@@ -1973,7 +2721,7 @@ SEXP rcLSgetParamLongDesc(SEXP sEnv,
     char      *Names[2] = {"ErrorCode", "szDescription"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2010,7 +2758,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetParamMacroName(SEXP sEnv,
@@ -2028,7 +2776,7 @@ SEXP rcLSgetParamMacroName(SEXP sEnv,
     char      *Names[2] = {"ErrorCode", "szParam"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2065,7 +2813,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetParamMacroID(SEXP sEnv,
@@ -2085,7 +2833,7 @@ SEXP rcLSgetParamMacroID(SEXP sEnv,
     char      *Names[3] = {"ErrorCode", "pnParamType", "pnParam"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2119,7 +2867,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetQCEigs(SEXP sModel,
@@ -2203,7 +2951,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 
@@ -2250,7 +2998,7 @@ SEXP rcLSloadLPData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_INT_ARRAY(panAcols,spanAcols);
     MAKE_REAL_ARRAY(padL,spadL);
@@ -2261,6 +3009,8 @@ SEXP rcLSloadLPData(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSloadLPData(pModel,
                                 nCons,
                                 nVars,
@@ -2284,7 +3034,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadQCData(SEXP      sModel,
@@ -2308,7 +3058,7 @@ SEXP rcLSloadQCData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2329,7 +3079,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadConeData(SEXP      sModel,
@@ -2353,7 +3103,7 @@ SEXP rcLSloadConeData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2374,7 +3124,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadPOSDData(SEXP      sModel,
@@ -2400,7 +3150,7 @@ SEXP rcLSloadPOSDData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2422,7 +3172,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadSETSData(SEXP      sModel,
@@ -2446,7 +3196,7 @@ SEXP rcLSloadSETSData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2467,7 +3217,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadSemiContData(SEXP      sModel,
@@ -2489,7 +3239,7 @@ SEXP rcLSloadSemiContData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2509,7 +3259,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadVarType(SEXP      sModel,
@@ -2525,7 +3275,7 @@ SEXP rcLSloadVarType(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2543,7 +3293,7 @@ ErrorReturn:
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadNameData(SEXP      sModel,
@@ -2573,7 +3323,7 @@ SEXP rcLSloadNameData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_ARRAY(pszTitle,spszTitle);
     MAKE_CHAR_ARRAY(pszObjName,spszObjName);
@@ -2589,6 +3339,8 @@ SEXP rcLSloadNameData(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSloadNameData(pModel,
                                   pszTitle,
                                   pszObjName,
@@ -2607,7 +3359,7 @@ ErrorReturn:
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadNLPData(SEXP      sModel,
@@ -2635,7 +3387,7 @@ SEXP rcLSloadNLPData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_REAL_ARRAY(padNLPcoef,spadNLPcoef);
     MAKE_REAL_ARRAY(padNLPobj,spadNLPobj);
@@ -2662,7 +3414,7 @@ ErrorReturn:
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadInstruct(SEXP      sModel,
@@ -2712,7 +3464,7 @@ SEXP rcLSloadInstruct(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_ARRAY(pszVarType,spszVarType);
     MAKE_INT_ARRAY(paiVars,spaiVars);
@@ -2724,6 +3476,8 @@ SEXP rcLSloadInstruct(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSloadInstruct(pModel,
                                   nCons,
                                   nObjs,
@@ -2751,7 +3505,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddInstruct(SEXP      sModel,
@@ -2801,7 +3555,7 @@ SEXP rcLSaddInstruct(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_ARRAY(pszVarType,spszVarType);
     MAKE_INT_ARRAY(paiCons,spaiCons);
@@ -2813,6 +3567,8 @@ SEXP rcLSaddInstruct(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSaddInstruct(pModel,
                                  nCons,
                                  nObjs,
@@ -2840,7 +3596,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadStringData(SEXP      sModel,
@@ -2858,7 +3614,7 @@ SEXP rcLSloadStringData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_CHAR_ARRAY(paszStringData,spaszStringData);
 
@@ -2878,7 +3634,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadString(SEXP      sModel,
@@ -2894,7 +3650,7 @@ SEXP rcLSloadString(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2911,7 +3667,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteStringData(SEXP      sModel)
@@ -2925,7 +3681,7 @@ SEXP rcLSdeleteStringData(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2941,7 +3697,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteString(SEXP      sModel)
@@ -2955,7 +3711,7 @@ SEXP rcLSdeleteString(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -2971,7 +3727,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStringValue(SEXP      sModel,
@@ -2989,7 +3745,7 @@ SEXP rcLSgetStringValue(SEXP      sModel,
     char      *Names[2] = {"ErrorCode", "pdValue"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3023,7 +3779,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConstraintProperty(SEXP      sModel,
@@ -3041,7 +3797,7 @@ SEXP rcLSgetConstraintProperty(SEXP      sModel,
     char      *Names[2] = {"ErrorCode", "pnConptype"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3075,7 +3831,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetConstraintProperty(SEXP      sModel,
@@ -3093,7 +3849,7 @@ SEXP rcLSsetConstraintProperty(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3110,7 +3866,7 @@ ErrorReturn:
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadMultiStartSolution(SEXP      sModel,
@@ -3126,7 +3882,7 @@ SEXP rcLSloadMultiStartSolution(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3142,7 +3898,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadGASolution(SEXP      sModel,
@@ -3158,7 +3914,7 @@ SEXP rcLSloadGASolution(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3174,7 +3930,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddQCShift(SEXP      sModel,
@@ -3192,7 +3948,7 @@ SEXP rcLSaddQCShift(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3208,7 +3964,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetQCShift(SEXP      sModel,
@@ -3226,7 +3982,7 @@ SEXP rcLSgetQCShift(SEXP      sModel,
     char      *Names[2] = {"ErrorCode", "pdShift"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3255,7 +4011,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSresetQCShift(SEXP      sModel,
@@ -3271,7 +4027,7 @@ SEXP rcLSresetQCShift(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3287,7 +4043,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -3308,7 +4064,7 @@ SEXP rcLSloadBasis(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3324,7 +4080,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadVarPriorities(SEXP      sModel,
@@ -3340,7 +4096,7 @@ SEXP rcLSloadVarPriorities(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3356,7 +4112,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSreadVarPriorities(SEXP      sModel,
@@ -3372,7 +4128,7 @@ SEXP rcLSreadVarPriorities(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3388,7 +4144,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadVarStartPoint(SEXP      sModel,
@@ -3404,7 +4160,7 @@ SEXP rcLSloadVarStartPoint(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3420,7 +4176,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadVarStartPointPartial(SEXP      sModel,
@@ -3440,7 +4196,7 @@ SEXP rcLSloadVarStartPointPartial(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3456,7 +4212,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadMIPVarStartPoint(SEXP      sModel,
@@ -3472,7 +4228,7 @@ SEXP rcLSloadMIPVarStartPoint(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3488,7 +4244,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadMIPVarStartPointPartial(SEXP      sModel,
@@ -3508,7 +4264,7 @@ SEXP rcLSloadMIPVarStartPointPartial(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3524,7 +4280,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSreadVarStartPoint(SEXP      sModel,
@@ -3540,7 +4296,7 @@ SEXP rcLSreadVarStartPoint(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3557,7 +4313,7 @@ ErrorReturn:
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadBlockStructure(SEXP      sModel,
@@ -3579,7 +4335,7 @@ SEXP rcLSloadBlockStructure(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3600,7 +4356,7 @@ ErrorReturn:
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -3622,7 +4378,7 @@ SEXP rcLSoptimize(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3633,8 +4389,12 @@ SEXP rcLSoptimize(SEXP  sModel,
     nProtect += 1;
     pnStatus = INTEGER_POINTER(spnStatus);
 
+    rSyncCbDims(prModel);
+
     *pnErrorCode = LSoptimize(pModel,nMethod,pnStatus);
 
+    rFlushLogBuf(prModel);
+
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
@@ -3651,7 +4411,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsolveMIP(SEXP  sModel)
@@ -3667,7 +4427,7 @@ SEXP rcLSsolveMIP(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3681,8 +4441,12 @@ SEXP rcLSsolveMIP(SEXP  sModel)
     nProtect += 1;
     pnStatus = INTEGER_POINTER(spnStatus);
 
+    rSyncCbDims(prModel);
+
     *pnErrorCode = LSsolveMIP(pModel,pnStatus);
 
+    rFlushLogBuf(prModel);
+
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
@@ -3699,7 +4463,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsolveGOP(SEXP  sModel)
@@ -3715,7 +4479,7 @@ SEXP rcLSsolveGOP(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3726,8 +4490,12 @@ SEXP rcLSsolveGOP(SEXP  sModel)
     nProtect += 1;
     pnStatus = INTEGER_POINTER(spnStatus);
 
+    rSyncCbDims(prModel);
+
     *pnErrorCode = LSsolveGOP(pModel,pnStatus);
 
+    rFlushLogBuf(prModel);
+
 ErrorReturn:
     //allocate list
     SET_UP_LIST;
@@ -3744,7 +4512,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSoptimizeQP(SEXP  sModel)
@@ -3760,7 +4528,7 @@ SEXP rcLSoptimizeQP(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3789,7 +4557,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLScheckConvexity(SEXP  sModel)
@@ -3803,7 +4571,7 @@ SEXP rcLScheckConvexity(SEXP  sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3819,7 +4587,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsolveSBD(SEXP  sModel,
@@ -3841,7 +4609,7 @@ SEXP rcLSsolveSBD(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3874,7 +4642,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -3895,7 +4663,7 @@ SEXP rcLSgetIInfo(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3924,7 +4692,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDInfo(SEXP  sModel,
@@ -3942,7 +4710,7 @@ SEXP rcLSgetDInfo(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -3971,7 +4739,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetProfilerInfo(SEXP  sModel,
@@ -3991,7 +4759,7 @@ SEXP rcLSgetProfilerInfo(SEXP  sModel,
     char      *Names[3] = {"ErrorCode", "pnCalls", "pdElapsedTime"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -4026,7 +4794,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetProfilerContext(SEXP  sModel,
@@ -4044,7 +4812,7 @@ SEXP rcLSgetProfilerContext(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "szDescription"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -4074,7 +4842,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetPrimalSolution(SEXP  sModel)
@@ -4090,7 +4858,7 @@ SEXP rcLSgetPrimalSolution(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padPrimal"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -4123,7 +4891,7 @@ ErrorReturn:
     }
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDualSolution(SEXP  sModel)
@@ -4139,7 +4907,7 @@ SEXP rcLSgetDualSolution(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padDual"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -4172,7 +4940,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetReducedCosts(SEXP  sModel)
@@ -4188,7 +4956,7 @@ SEXP rcLSgetReducedCosts(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padReducedCost"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -4222,7 +4990,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetReducedCostsCone(SEXP  sModel)
@@ -4238,7 +5006,7 @@ SEXP rcLSgetReducedCostsCone(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padReducedCost"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -4271,7 +5039,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetSlacks(SEXP  sModel)
@@ -4287,7 +5055,7 @@ SEXP rcLSgetSlacks(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padSlack"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -4321,7 +5089,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetBasis(SEXP  sModel)
@@ -4339,7 +5107,7 @@ SEXP rcLSgetBasis(SEXP  sModel)
     char      *Names[3] = {"ErrorCode", "panCstatus", "panRstatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons, nVars;
 
     //errorcode item
@@ -4379,7 +5147,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetSolution(SEXP  sModel,
@@ -4397,7 +5165,7 @@ SEXP rcLSgetSolution(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "padResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -4430,7 +5198,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetMIPPrimalSolution(SEXP  sModel)
@@ -4446,7 +5214,7 @@ SEXP rcLSgetMIPPrimalSolution(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padPrimal"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -4479,7 +5247,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetMIPDualSolution(SEXP  sModel)
@@ -4495,7 +5263,7 @@ SEXP rcLSgetMIPDualSolution(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padDual"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -4528,7 +5296,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetMIPReducedCosts(SEXP  sModel)
@@ -4544,7 +5312,7 @@ SEXP rcLSgetMIPReducedCosts(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padReducedCost"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -4577,7 +5345,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetMIPSlacks(SEXP  sModel)
@@ -4593,7 +5361,7 @@ SEXP rcLSgetMIPSlacks(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padSlack"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -4626,7 +5394,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetMIPBasis(SEXP  sModel)
@@ -4644,7 +5412,7 @@ SEXP rcLSgetMIPBasis(SEXP  sModel)
     char      *Names[3] = {"ErrorCode", "panCstatus", "panRstatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons, nVars;
 
     //errorcode item
@@ -4684,7 +5452,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNextBestMIPSol(SEXP  sModel)
@@ -4700,7 +5468,7 @@ SEXP rcLSgetNextBestMIPSol(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -4729,7 +5497,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -4770,7 +5538,7 @@ SEXP rcLSgetLPData(SEXP  sModel)
                             "paiArows", "padL", "padU"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 12;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons, nVars, nNnz;
 
     //errorcode item
@@ -4803,7 +5571,7 @@ SEXP rcLSgetLPData(SEXP  sModel)
 
     PROTECT(spachConTypes = NEW_CHARACTER(1));
     nProtect += 1;
-    pachConTypes = (char *)malloc(sizeof(char)*(nCons+1));
+    pachConTypes = R_alloc(nCons+1, sizeof(char));
     pachConTypes[nCons] = '\0';
 
     PROTECT(spaiAcols = NEW_INTEGER(nVars+1));
@@ -4873,7 +5641,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetQCData(SEXP  sModel)
@@ -4896,7 +5664,7 @@ SEXP rcLSgetQCData(SEXP  sModel)
     char      *Names[5] = {"ErrorCode", "paiQCrows","paiQCcols1","paiQCcols2","padQCcoef"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nNnz;
 
     //errorcode item
@@ -4948,7 +5716,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetQCDatai(SEXP  sModel,
@@ -4973,7 +5741,7 @@ SEXP rcLSgetQCDatai(SEXP  sModel,
     char      *Names[5] = {"ErrorCode", "pnQCnnz","paiQCcols1","paiQCcols2","padQCcoef"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nNnz=0;
 
     //errorcode item
@@ -5034,7 +5802,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetVarType(SEXP  sModel)
@@ -5050,7 +5818,7 @@ SEXP rcLSgetVarType(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "pachVarTypes"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5088,7 +5856,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetVarStartPoint(SEXP  sModel)
@@ -5104,7 +5872,7 @@ SEXP rcLSgetVarStartPoint(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padPrimal"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5137,7 +5905,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetVarStartPointPartial(SEXP  sModel)
@@ -5161,7 +5929,7 @@ SEXP rcLSgetVarStartPointPartial(SEXP  sModel)
     char      *Names[4] = {"ErrorCode", "pnCols", "paiCols", "padPrimal"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5215,7 +5983,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetMIPVarStartPointPartial(SEXP  sModel)
@@ -5239,7 +6007,7 @@ SEXP rcLSgetMIPVarStartPointPartial(SEXP  sModel)
     char      *Names[4] = {"ErrorCode", "pnCols", "paiCols", "panPrimal"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5293,7 +6061,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetMIPVarStartPoint(SEXP  sModel)
@@ -5309,7 +6077,7 @@ SEXP rcLSgetMIPVarStartPoint(SEXP  sModel)
     char      *Names[2] = {"ErrorCode", "padPrimal"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5342,7 +6110,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetSETSData(SEXP  sModel)
@@ -5371,7 +6139,7 @@ SEXP rcLSgetSETSData(SEXP  sModel)
                            "piCardnum", "piNnz", "piBegset", "piVarndx"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 8;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5467,7 +6235,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetSETSDatai(SEXP  sModel,
@@ -5491,7 +6259,7 @@ SEXP rcLSgetSETSDatai(SEXP  sModel,
     char      *Names[5] = {"ErrorCode", "pachSETtype", "piCardnum", "piNnz", "piVarndx"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5554,7 +6322,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetSemiContData(SEXP  sModel)
@@ -5575,7 +6343,7 @@ SEXP rcLSgetSemiContData(SEXP  sModel)
     char      *Names[5] = {"ErrorCode", "piNvars", "panVarndx", "padL", "padU"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -5644,7 +6412,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetLPVariableDataj(SEXP  sModel,
@@ -5675,7 +6443,7 @@ SEXP rcLSgetLPVariableDataj(SEXP  sModel,
                            "pnAnnz","paiArows", "padAcoef"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 8;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -5761,7 +6529,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetVariableNamej(SEXP  sModel,
@@ -5773,13 +6541,13 @@ SEXP rcLSgetVariableNamej(SEXP  sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    char      *pachVarName;
+    char      pachVarName[256];
     SEXP      spachVarName = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[2] = {"ErrorCode", "pachVarName"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -5788,7 +6556,6 @@ SEXP rcLSgetVariableNamej(SEXP  sModel,
 
     PROTECT(spachVarName = NEW_CHARACTER(1));
     nProtect += 1;
-    pachVarName = (char *)malloc(sizeof(char)*(256));
 
     *pnErrorCode = LSgetVariableNamej(pModel,
                                       iVar,
@@ -5813,7 +6580,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetVariableIndex(SEXP  sModel,
@@ -5831,7 +6598,7 @@ SEXP rcLSgetVariableIndex(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "piVar"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -5860,7 +6627,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConstraintNamei(SEXP     sModel,
@@ -5872,13 +6639,13 @@ SEXP rcLSgetConstraintNamei(SEXP     sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    char      *pachConName;
+    char      pachConName[256];
     SEXP      spachConName = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[2] = {"ErrorCode", "pachConName"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -5887,7 +6654,6 @@ SEXP rcLSgetConstraintNamei(SEXP     sModel,
 
     PROTECT(spachConName = NEW_CHARACTER(1));
     nProtect += 1;
-    pachConName = (char *)malloc(sizeof(char)*(256));
 
     *pnErrorCode = LSgetConstraintNamei(pModel,
                                         iCon,
@@ -5912,7 +6678,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConstraintIndex(SEXP  sModel,
@@ -5930,7 +6696,7 @@ SEXP rcLSgetConstraintIndex(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "piCon"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -5959,7 +6725,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConstraintDatai(SEXP      sModel,
@@ -5981,7 +6747,7 @@ SEXP rcLSgetConstraintDatai(SEXP      sModel,
     char      *Names[4] = {"ErrorCode", "pchConType", "pchIsNlp", "pdB"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6028,7 +6794,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetLPConstraintDatai(SEXP      sModel,
@@ -6054,7 +6820,7 @@ SEXP rcLSgetLPConstraintDatai(SEXP      sModel,
     char      *Names[6] = {"ErrorCode", "pchConType", "pdB", "pnNnz", "paiVar", "padAcoef"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 6;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nNnz;
 
     //errorcode item
@@ -6117,7 +6883,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConeNamei(SEXP     sModel,
@@ -6129,13 +6895,13 @@ SEXP rcLSgetConeNamei(SEXP     sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    char      *pachConeName;
+    char      pachConeName[256];
     SEXP      spachConeName = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[2] = {"ErrorCode", "pachConeName"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6144,7 +6910,6 @@ SEXP rcLSgetConeNamei(SEXP     sModel,
 
     PROTECT(spachConeName = NEW_CHARACTER(1));
     nProtect += 1;
-    pachConeName = (char *)malloc(sizeof(char)*(256));
 
     *pnErrorCode = LSgetConeNamei(pModel,
                                   iCone,
@@ -6169,7 +6934,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConeIndex(SEXP  sModel,
@@ -6187,7 +6952,7 @@ SEXP rcLSgetConeIndex(SEXP  sModel,
     char      *Names[2] = {"ErrorCode", "piCone"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6216,7 +6981,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConeDatai(SEXP      sModel,
@@ -6238,7 +7003,7 @@ SEXP rcLSgetConeDatai(SEXP      sModel,
     char      *Names[5] = {"ErrorCode", "pchConeType", "pdConeAlpha", "piNnz", "paiCols"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nNnz;
     double    *pdConeAlpha;
     SEXP      spdConeAlpha = R_NilValue;
@@ -6292,7 +7057,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNLPData(SEXP      sModel)
@@ -6324,7 +7089,7 @@ SEXP rcLSgetNLPData(SEXP      sModel)
                            "paiNLPobj","padNLPobj", "pachNLPConTypes"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 9;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars, nCons;
 
     //errorcode item
@@ -6408,7 +7173,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNLPConstraintDatai(SEXP  sModel,
@@ -6431,7 +7196,7 @@ SEXP rcLSgetNLPConstraintDatai(SEXP  sModel,
     char      *Names[4] = {"ErrorCode", "pnNnz","paiNLPcols","padNLPcoef"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6479,7 +7244,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNLPVariableDataj(SEXP  sModel,
@@ -6502,7 +7267,7 @@ SEXP rcLSgetNLPVariableDataj(SEXP  sModel,
     char      *Names[4] = {"ErrorCode", "pnNnz","panNLProws","padNLPcoef"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6550,7 +7315,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNLPObjectiveData(SEXP  sModel)
@@ -6571,7 +7336,7 @@ SEXP rcLSgetNLPObjectiveData(SEXP  sModel)
     char      *Names[4] = {"ErrorCode", "pnNLPobjnnz","paiNLPobj","padNLPobj"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6619,7 +7384,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDualModel(SEXP sModel,
@@ -6636,7 +7401,7 @@ SEXP rcLSgetDualModel(SEXP sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6663,7 +7428,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLScalinfeasMIPsolution(SEXP sModel,
@@ -6684,7 +7449,7 @@ SEXP rcLScalinfeasMIPsolution(SEXP sModel,
     char      *Names[3] = {"ErrorCode", "pdIntPfeas", "pbConsPfeas"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -6721,7 +7486,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetRoundMIPsolution(SEXP      sModel,
@@ -6750,7 +7515,7 @@ SEXP rcLSgetRoundMIPsolution(SEXP      sModel,
     char      *Names[5] = {"ErrorCode", "padPrimalRound", "pdObjRound", "pdPfeasRound", "pnstatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -6807,7 +7572,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetRangeData(SEXP      sModel)
@@ -6823,7 +7588,7 @@ SEXP rcLSgetRangeData(SEXP      sModel)
     char      *Names[2] = {"ErrorCode", "padR"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -6856,7 +7621,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -6887,7 +7652,7 @@ SEXP rcLSaddConstraints(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_CHAR_ARRAY(paszConNames,spaszConNames);
 
@@ -6896,6 +7661,8 @@ SEXP rcLSaddConstraints(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSaddConstraints(pModel,
                                     nNumaddcons,
                                     pszConTypes,
@@ -6912,7 +7679,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddVariables(SEXP      sModel,
@@ -6946,7 +7713,7 @@ SEXP rcLSaddVariables(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_CHAR_ARRAY(paszVarNames,spaszVarNames);
     MAKE_INT_ARRAY(panAcols,spanAcols);
@@ -6958,6 +7725,8 @@ SEXP rcLSaddVariables(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSaddVariables(pModel,
                                   nNumaddvars,
                                   pszVarTypes,
@@ -6977,7 +7746,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddCones(SEXP      sModel,
@@ -7003,7 +7772,7 @@ SEXP rcLSaddCones(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_CHAR_ARRAY(paszConenames,spaszConenames);
 
@@ -7027,7 +7796,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddSETS(SEXP      sModel,
@@ -7051,7 +7820,7 @@ SEXP rcLSaddSETS(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7072,7 +7841,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddQCterms(SEXP      sModel,
@@ -7096,7 +7865,7 @@ SEXP rcLSaddQCterms(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7117,7 +7886,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteConstraints(SEXP      sModel,
@@ -7135,13 +7904,15 @@ SEXP rcLSdeleteConstraints(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSdeleteConstraints(pModel,nCons,paiCons);
 
 ErrorReturn:
@@ -7151,7 +7922,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteSETS(SEXP      sModel,
@@ -7169,7 +7940,7 @@ SEXP rcLSdeleteSETS(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7185,7 +7956,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteCones(SEXP      sModel,
@@ -7203,7 +7974,7 @@ SEXP rcLSdeleteCones(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7219,7 +7990,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteSemiContVars(SEXP      sModel,
@@ -7237,7 +8008,7 @@ SEXP rcLSdeleteSemiContVars(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7253,7 +8024,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteVariables(SEXP      sModel,
@@ -7271,13 +8042,15 @@ SEXP rcLSdeleteVariables(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSdeleteVariables(pModel,nVars,paiVars);
 
 ErrorReturn:
@@ -7287,7 +8060,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteQCterms(SEXP      sModel,
@@ -7305,7 +8078,7 @@ SEXP rcLSdeleteQCterms(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7321,7 +8094,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteAj(SEXP      sModel,
@@ -7341,7 +8114,7 @@ SEXP rcLSdeleteAj(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7357,7 +8130,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyLowerBounds(SEXP      sModel,
@@ -7377,7 +8150,7 @@ SEXP rcLSmodifyLowerBounds(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7393,7 +8166,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyUpperBounds(SEXP      sModel,
@@ -7413,7 +8186,7 @@ SEXP rcLSmodifyUpperBounds(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7429,7 +8202,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyRHS(SEXP      sModel,
@@ -7449,7 +8222,7 @@ SEXP rcLSmodifyRHS(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7465,7 +8238,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyObjective(SEXP      sModel,
@@ -7485,7 +8258,7 @@ SEXP rcLSmodifyObjective(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7501,7 +8274,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyAj(SEXP     sModel,
@@ -7523,7 +8296,7 @@ SEXP rcLSmodifyAj(SEXP     sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7539,7 +8312,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyCone(SEXP     sModel,
@@ -7563,7 +8336,7 @@ SEXP rcLSmodifyCone(SEXP     sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7579,7 +8352,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifySET(SEXP     sModel,
@@ -7601,7 +8374,7 @@ SEXP rcLSmodifySET(SEXP     sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7617,7 +8390,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifySemiContVars(SEXP     sModel,
@@ -7639,7 +8412,7 @@ SEXP rcLSmodifySemiContVars(SEXP     sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7655,7 +8428,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyConstraintType(SEXP     sModel,
@@ -7676,7 +8449,7 @@ SEXP rcLSmodifyConstraintType(SEXP     sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7692,7 +8465,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSmodifyVariableType(SEXP     sModel,
@@ -7713,7 +8486,7 @@ SEXP rcLSmodifyVariableType(SEXP     sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7729,7 +8502,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddNLPAj(SEXP     sModel,
@@ -7751,7 +8524,7 @@ SEXP rcLSaddNLPAj(SEXP     sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7767,7 +8540,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddNLPobj(SEXP      sModel,
@@ -7787,7 +8560,7 @@ SEXP rcLSaddNLPobj(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7803,7 +8576,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeleteNLPobj(SEXP      sModel,
@@ -7821,7 +8594,7 @@ SEXP rcLSdeleteNLPobj(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -7837,7 +8610,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -7858,7 +8631,7 @@ SEXP rcLSgetConstraintRanges(SEXP      sModel)
     char      *Names[3] = {"ErrorCode", "padDec", "padInc"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -7896,7 +8669,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetObjectiveRanges_x(SEXP      sModel)
@@ -7914,7 +8687,7 @@ SEXP rcLSgetObjectiveRanges_x(SEXP      sModel)
     char      *Names[3] = {"ErrorCode", "padDec", "padInc"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -7952,7 +8725,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetBoundRanges(SEXP      sModel)
@@ -7970,7 +8743,7 @@ SEXP rcLSgetBoundRanges(SEXP      sModel)
     char      *Names[3] = {"ErrorCode", "padDec", "padInc"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -8008,7 +8781,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetBestBounds(SEXP      sModel)
@@ -8026,7 +8799,7 @@ SEXP rcLSgetBestBounds(SEXP      sModel)
     char      *Names[3] = {"ErrorCode", "padBestL", "padBestU"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -8064,7 +8837,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfindIIS(SEXP      sModel,
@@ -8080,7 +8853,7 @@ SEXP rcLSfindIIS(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8096,7 +8869,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfindIUS(SEXP      sModel,
@@ -8112,7 +8885,7 @@ SEXP rcLSfindIUS(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8128,7 +8901,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfindBlockStructure(SEXP      sModel,
@@ -8146,7 +8919,7 @@ SEXP rcLSfindBlockStructure(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8162,7 +8935,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetIIS(SEXP      sModel)
@@ -8191,7 +8964,7 @@ SEXP rcLSgetIIS(SEXP      sModel)
                            "pnSuf_c","pnIIS_c","paiVars", "panBnds"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 8;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8254,7 +9027,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetIUS(SEXP      sModel)
@@ -8274,7 +9047,7 @@ SEXP rcLSgetIUS(SEXP      sModel)
     char      *Names[4] = {"ErrorCode","pnSuf","pnIUS","paiVars"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8317,7 +9090,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetBlockStructure(SEXP      sModel)
@@ -8339,7 +9112,7 @@ SEXP rcLSgetBlockStructure(SEXP      sModel)
     char      *Names[5] = {"ErrorCode","pnBlock","panRblock","panCblock","pnType"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars, nCons;
 
     //errorcode item
@@ -8389,7 +9162,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -8414,7 +9187,7 @@ SEXP rcLSfreeSolverMemory(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8430,7 +9203,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfreeHashMemory(SEXP      sModel)
@@ -8444,7 +9217,7 @@ SEXP rcLSfreeHashMemory(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8460,7 +9233,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfreeSolutionMemory(SEXP      sModel)
@@ -8474,7 +9247,7 @@ SEXP rcLSfreeSolutionMemory(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8490,7 +9263,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfreeMIPSolutionMemory(SEXP      sModel)
@@ -8504,7 +9277,7 @@ SEXP rcLSfreeMIPSolutionMemory(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8520,7 +9293,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfreeGOPSolutionMemory(SEXP      sModel)
@@ -8534,7 +9307,7 @@ SEXP rcLSfreeGOPSolutionMemory(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8550,7 +9323,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetProbAllocSizes(SEXP      sModel,
@@ -8576,7 +9349,7 @@ SEXP rcLSsetProbAllocSizes(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8598,7 +9371,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetProbNameAllocSizes(SEXP      sModel,
@@ -8616,7 +9389,7 @@ SEXP rcLSsetProbNameAllocSizes(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8634,7 +9407,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddEmptySpacesAcolumns(SEXP      sModel,
@@ -8650,7 +9423,7 @@ SEXP rcLSaddEmptySpacesAcolumns(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8667,7 +9440,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddEmptySpacesNLPAcolumns(SEXP      sModel,
@@ -8683,7 +9456,7 @@ SEXP rcLSaddEmptySpacesNLPAcolumns(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8700,7 +9473,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -8731,7 +9504,7 @@ SEXP rcLSwriteDeteqMPSFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8747,7 +9520,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteDeteqLINDOFile(SEXP      sModel,
@@ -8765,7 +9538,7 @@ SEXP rcLSwriteDeteqLINDOFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8781,7 +9554,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteSMPSFile(SEXP      sModel,
@@ -8803,7 +9576,7 @@ SEXP rcLSwriteSMPSFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8819,7 +9592,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSreadSMPSFile(SEXP      sModel,
@@ -8841,13 +9614,15 @@ SEXP rcLSreadSMPSFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSreadSMPSFile(pModel,pszCorefile,pszTimefile,pszStocfile,nMPStype);
 
 ErrorReturn:
@@ -8857,7 +9632,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteSMPIFile(SEXP      sModel,
@@ -8877,7 +9652,7 @@ SEXP rcLSwriteSMPIFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8893,7 +9668,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSreadSMPIFile(SEXP      sModel,
@@ -8913,13 +9688,15 @@ SEXP rcLSreadSMPIFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
     CHECK_MODEL_ERROR;
 
+    rDropNameIndex(prModel);
+
     *pnErrorCode = LSreadSMPIFile(pModel,pszCorefile,pszTimefile,pszStocfile);
 
 ErrorReturn:
@@ -8929,7 +9706,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteScenarioSolutionFile(SEXP      sModel,
@@ -8947,7 +9724,7 @@ SEXP rcLSwriteScenarioSolutionFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8963,7 +9740,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteNodeSolutionFile(SEXP      sModel,
@@ -8983,7 +9760,7 @@ SEXP rcLSwriteNodeSolutionFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -8999,7 +9776,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteScenarioMPIFile(SEXP      sModel,
@@ -9017,7 +9794,7 @@ SEXP rcLSwriteScenarioMPIFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9033,7 +9810,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteScenarioMPSFile(SEXP      sModel,
@@ -9053,7 +9830,7 @@ SEXP rcLSwriteScenarioMPSFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9069,7 +9846,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSwriteScenarioLINDOFile(SEXP      sModel,
@@ -9087,7 +9864,7 @@ SEXP rcLSwriteScenarioLINDOFile(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9103,7 +9880,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetModelStocDouParameter(SEXP      sModel,
@@ -9121,7 +9898,7 @@ SEXP rcLSsetModelStocDouParameter(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9137,7 +9914,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetModelStocDouParameter(SEXP      sModel,
@@ -9155,7 +9932,7 @@ SEXP rcLSgetModelStocDouParameter(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pdValue"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9184,7 +9961,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetModelStocIntParameter(SEXP      sModel,
@@ -9202,7 +9979,7 @@ SEXP rcLSsetModelStocIntParameter(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9218,7 +9995,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetModelStocIntParameter(SEXP      sModel,
@@ -9236,7 +10013,7 @@ SEXP rcLSgetModelStocIntParameter(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","piValue"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9265,7 +10042,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioIndex(SEXP      sModel,
@@ -9283,7 +10060,7 @@ SEXP rcLSgetScenarioIndex(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pnIndex"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9312,7 +10089,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStageIndex(SEXP      sModel,
@@ -9330,7 +10107,7 @@ SEXP rcLSgetStageIndex(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pnIndex"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9359,7 +10136,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocParIndex(SEXP      sModel,
@@ -9377,7 +10154,7 @@ SEXP rcLSgetStocParIndex(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pnIndex"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9406,7 +10183,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocParName(SEXP      sModel,
@@ -9418,13 +10195,13 @@ SEXP rcLSgetStocParName(SEXP      sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    char      *pachName;
+    char      pachName[256];
     SEXP      spachName = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[2] = {"ErrorCode","pachName"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9433,7 +10210,6 @@ SEXP rcLSgetStocParName(SEXP      sModel,
 
     PROTECT(spachName = NEW_CHARACTER(1));
     nProtect += 1;
-    pachName = (char *)malloc(sizeof(char)*(256));
 
     *pnErrorCode = LSgetStocParName(pModel,nIndex,pachName);
 
@@ -9457,7 +10233,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioName(SEXP      sModel,
@@ -9469,13 +10245,13 @@ SEXP rcLSgetScenarioName(SEXP      sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    char      *pachName;
+    char      pachName[256];
     SEXP      spachName = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[2] = {"ErrorCode","pachName"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9484,7 +10260,6 @@ SEXP rcLSgetScenarioName(SEXP      sModel,
 
     PROTECT(spachName = NEW_CHARACTER(1));
     nProtect += 1;
-    pachName = (char *)malloc(sizeof(char)*(256));
 
     *pnErrorCode = LSgetScenarioName(pModel,nIndex,pachName);
 
@@ -9508,7 +10283,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStageName(SEXP      sModel,
@@ -9520,13 +10295,13 @@ SEXP rcLSgetStageName(SEXP      sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
-    char      *pachName;
+    char      pachName[256];
     SEXP      spachName = R_NilValue;
     SEXP      rList = R_NilValue;
     char      *Names[2] = {"ErrorCode","pachName"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9535,7 +10310,6 @@ SEXP rcLSgetStageName(SEXP      sModel,
 
     PROTECT(spachName = NEW_CHARACTER(1));
     nProtect += 1;
-    pachName = (char *)malloc(sizeof(char)*(256));
 
     *pnErrorCode = LSgetStageName(pModel,nIndex,pachName);
 
@@ -9559,7 +10333,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocIInfo(SEXP      sModel,
@@ -9579,7 +10353,7 @@ SEXP rcLSgetStocIInfo(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9608,7 +10382,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocDInfo(SEXP      sModel,
@@ -9628,7 +10402,7 @@ SEXP rcLSgetStocDInfo(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9657,7 +10431,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocSInfo(SEXP      sModel,
@@ -9677,7 +10451,7 @@ SEXP rcLSgetStocSInfo(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pszResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9710,7 +10484,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocCCPIInfo(SEXP      sModel,
@@ -9732,7 +10506,7 @@ SEXP rcLSgetStocCCPIInfo(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9761,7 +10535,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocCCPDInfo(SEXP      sModel,
@@ -9783,7 +10557,7 @@ SEXP rcLSgetStocCCPDInfo(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9812,7 +10586,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocCCPSInfo(SEXP      sModel,
@@ -9834,7 +10608,7 @@ SEXP rcLSgetStocCCPSInfo(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pszResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9867,7 +10641,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadSampleSizes(SEXP      sModel,
@@ -9883,7 +10657,7 @@ SEXP rcLSloadSampleSizes(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9899,7 +10673,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadConstraintStages(SEXP      sModel,
@@ -9915,7 +10689,7 @@ SEXP rcLSloadConstraintStages(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9931,7 +10705,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadVariableStages(SEXP      sModel,
@@ -9947,7 +10721,7 @@ SEXP rcLSloadVariableStages(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9963,7 +10737,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadStageData(SEXP      sModel,
@@ -9983,7 +10757,7 @@ SEXP rcLSloadStageData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -9999,7 +10773,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadStocParData(SEXP      sModel,
@@ -10017,7 +10791,7 @@ SEXP rcLSloadStocParData(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10033,7 +10807,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadStocParNames(SEXP      sModel,
@@ -10051,7 +10825,7 @@ SEXP rcLSloadStocParNames(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     MAKE_CHAR_CHAR_ARRAY(paszSVarNames,spaszSVarNames);
 
@@ -10069,7 +10843,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDeteqModel(SEXP      sModel,
@@ -10081,6 +10855,7 @@ SEXP rcLSgetDeteqModel(SEXP      sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
+    pLSmodel  pdModel = NULL;
     prLSmodel prdModel = NULL;
     SEXP      sprdModel = R_NilValue;
     int       nProtect = 0;
@@ -10090,25 +10865,30 @@ SEXP rcLSgetDeteqModel(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
-    prdModel = (prLSmodel)malloc(sizeof(rLSmodel)*1);
+    pdModel = LSgetDeteqModel(pModel,iDeqType,pnErrorCode);
+    CHECK_ERRCODE;
+
+    prdModel = rNewModel(pdModel,prModel->prEnv);
     if(prdModel == NULL)
     {
-        return R_NilValue;
+        LSdeleteModel(&pdModel);
+        *pnErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
     }
 
-    prdModel->pModel = LSgetDeteqModel(pModel,iDeqType,pnErrorCode);
-    CHECK_ERRCODE;
-
     SET_PRINT_LOG(prdModel->pModel,*pnErrorCode);
     CHECK_ERRCODE;
 
-    SET_MODEL_CALLBACK(prdModel->pModel,*pnErrorCode);
+    SET_MODEL_CALLBACK(prdModel->pModel,prdModel,*pnErrorCode);
     CHECK_ERRCODE;
 
-    sprdModel = R_MakeExternalPtr(prdModel,R_NilValue,R_NilValue);
+    PROTECT(sprdModel = R_MakeExternalPtr(prdModel,R_NilValue,R_ExternalPtrProtected(sModel)));
+    nProtect += 1;
 
     R_SetExternalPtrTag(sprdModel,tagLSprob);
 
+    R_RegisterCFinalizerEx(sprdModel,rFinalizeModel,TRUE);
+
 ErrorReturn:
 
     UNPROTECT(nProtect);
@@ -10117,6 +10897,10 @@ ErrorReturn:
     {
         Rprintf("\nFail to get DeteqModel (error %d)\n",*pnErrorCode);
         R_FlushConsole();
+        if(prdModel != NULL)
+        {
+            rFreeModel(prdModel);
+        }
         return R_NilValue;
     }
     else
@@ -10140,7 +10924,7 @@ SEXP rcLSaggregateStages(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10158,7 +10942,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStageAggScheme(SEXP      sModel)
@@ -10176,7 +10960,7 @@ SEXP rcLSgetStageAggScheme(SEXP      sModel)
     char      *Names[3] = {"ErrorCode","panScheme","pnLength"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10214,7 +10998,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdeduceStages(SEXP      sModel,
@@ -10240,7 +11024,7 @@ SEXP rcLSdeduceStages(SEXP      sModel,
     char      *Names[3] = {"ErrorCode","panRowStagseOut","panColStagesOut"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars, nCons;
 
     //errorcode item
@@ -10283,7 +11067,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsolveSP(SEXP      sModel)
@@ -10299,7 +11083,7 @@ SEXP rcLSsolveSP(SEXP      sModel)
     char      *Names[2] = {"ErrorCode","pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10328,7 +11112,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 
 }
 
@@ -10347,7 +11131,7 @@ SEXP rcLSsolveHS(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10376,7 +11160,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioObjective(SEXP      sModel,
@@ -10394,7 +11178,7 @@ SEXP rcLSgetScenarioObjective(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pdObj"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10423,7 +11207,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNodePrimalSolution(SEXP      sModel,
@@ -10443,7 +11227,7 @@ SEXP rcLSgetNodePrimalSolution(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","padX"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -10476,7 +11260,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNodeDualSolution(SEXP      sModel,
@@ -10496,7 +11280,7 @@ SEXP rcLSgetNodeDualSolution(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","padY"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -10529,7 +11313,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNodeReducedCost(SEXP      sModel,
@@ -10549,7 +11333,7 @@ SEXP rcLSgetNodeReducedCost(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","padX"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -10582,7 +11366,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNodeSlacks(SEXP      sModel,
@@ -10602,7 +11386,7 @@ SEXP rcLSgetNodeSlacks(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","padY"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -10635,7 +11419,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioPrimalSolution(SEXP      sModel,
@@ -10655,7 +11439,7 @@ SEXP rcLSgetScenarioPrimalSolution(SEXP      sModel,
     char      *Names[3] = {"ErrorCode","padX","pdObj"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -10693,7 +11477,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioReducedCost(SEXP      sModel,
@@ -10711,7 +11495,7 @@ SEXP rcLSgetScenarioReducedCost(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","padX"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nVars;
 
     //errorcode item
@@ -10744,7 +11528,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioDualSolution(SEXP      sModel,
@@ -10762,7 +11546,7 @@ SEXP rcLSgetScenarioDualSolution(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","padY"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -10795,7 +11579,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioSlacks(SEXP      sModel,
@@ -10813,7 +11597,7 @@ SEXP rcLSgetScenarioSlacks(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","padY"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nCons;
 
     //errorcode item
@@ -10846,7 +11630,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetNodeListByScenario(SEXP      sModel,
@@ -10866,7 +11650,7 @@ SEXP rcLSgetNodeListByScenario(SEXP      sModel,
     char      *Names[3] = {"ErrorCode","paiNodes","pnNodes"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10903,7 +11687,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetProbabilityByScenario(SEXP      sModel,
@@ -10921,7 +11705,7 @@ SEXP rcLSgetProbabilityByScenario(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pdProb"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10950,7 +11734,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetProbabilityByNode(SEXP      sModel,
@@ -10968,7 +11752,7 @@ SEXP rcLSgetProbabilityByNode(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pdProb"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -10997,7 +11781,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocParData(SEXP      sModel)
@@ -11015,7 +11799,7 @@ SEXP rcLSgetStocParData(SEXP      sModel)
     char      *Names[3] = {"ErrorCode","paiStages", "padVals"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nSpars;
 
     //errorcode item
@@ -11053,7 +11837,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddDiscreteBlocks(SEXP      sModel,
@@ -11085,7 +11869,7 @@ SEXP rcLSaddDiscreteBlocks(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11111,7 +11895,7 @@ ErrorReturn:
     UNPROTECT(nProtect + 2);
 
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddScenario(SEXP      sModel,
@@ -11145,7 +11929,7 @@ SEXP rcLSaddScenario(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11171,7 +11955,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddDiscreteIndep(SEXP      sModel,
@@ -11199,7 +11983,7 @@ SEXP rcLSaddDiscreteIndep(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11222,7 +12006,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddParamDistIndep(SEXP      sModel,
@@ -11250,7 +12034,7 @@ SEXP rcLSaddParamDistIndep(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11273,7 +12057,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSaddChanceConstraint(SEXP      sModel,
@@ -11297,7 +12081,7 @@ SEXP rcLSaddChanceConstraint(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11318,7 +12102,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetNumStages(SEXP      sModel,
@@ -11334,7 +12118,7 @@ SEXP rcLSsetNumStages(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11351,7 +12135,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocParOutcomes(SEXP      sModel,
@@ -11371,7 +12155,7 @@ SEXP rcLSgetStocParOutcomes(SEXP      sModel,
     char      *Names[3] = {"ErrorCode","padVals", "pdProb"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     int       nSpars;
 
     //errorcode item
@@ -11409,7 +12193,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSloadCorrelationMatrix(SEXP      sModel,
@@ -11435,7 +12219,7 @@ SEXP rcLSloadCorrelationMatrix(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11457,7 +12241,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetCorrelationMatrix(SEXP      sModel,
@@ -11483,7 +12267,7 @@ SEXP rcLSgetCorrelationMatrix(SEXP      sModel,
     char      *Names[5] = {"ErrorCode","pnQCnnz","paiQCcols1","paiQCcols2","padQCcoef"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11531,7 +12315,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocParSample(SEXP      sModel,
@@ -11562,13 +12346,17 @@ SEXP rcLSgetStocParSample(SEXP      sModel,
         return R_NilValue;
     }
 
+    //the sample belongs to the model, keep the model alive instead of the env
     prSample->pSample = LSgetStocParSample(pModel,iStv,iRow,jCol,pnErrorCode);
+    prSample->prEnv = NULL;
     CHECK_ERRCODE;
 
-    sprSample = R_MakeExternalPtr(prSample,R_NilValue,R_NilValue);
+    sprSample = R_MakeExternalPtr(prSample,R_NilValue,sModel);
 
     R_SetExternalPtrTag(sprSample,tagLSsample);
 
+    R_RegisterCFinalizerEx(sprSample,rFinalizeSample,TRUE);
+
 ErrorReturn:
 
     UNPROTECT(1);
@@ -11577,6 +12365,10 @@ ErrorReturn:
     {
         Rprintf("\nFail to get Sample object (error %d)\n",*pnErrorCode);
         R_FlushConsole();
+        if(prSample != NULL)
+        {
+            free(prSample);
+        }
         return R_NilValue;
     }
     else
@@ -11609,7 +12401,7 @@ SEXP rcLSgetDiscreteBlocks(SEXP      sModel,
                            "nRealzBlock","padProbs","iModifyRule"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 6;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11662,7 +12454,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDiscreteBlockOutcomes(SEXP      sModel,
@@ -11691,7 +12483,7 @@ SEXP rcLSgetDiscreteBlockOutcomes(SEXP      sModel,
                            "paiAcols","paiStvs","padVals"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 6;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11745,7 +12537,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDiscreteIndep(SEXP      sModel,
@@ -11781,7 +12573,7 @@ SEXP rcLSgetDiscreteIndep(SEXP      sModel,
                             "padProbs","padVals","iModifyRule"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 10;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11855,7 +12647,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetParamDistIndep(SEXP      sModel,
@@ -11889,7 +12681,7 @@ SEXP rcLSgetParamDistIndep(SEXP      sModel,
                             "padParams","iModifyRule"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 9;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -11958,7 +12750,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenario(SEXP      sModel,
@@ -11994,7 +12786,7 @@ SEXP rcLSgetScenario(SEXP      sModel,
                             "paiStvs","padVals","iModifyRule"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 10;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12068,7 +12860,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetChanceConstraint(SEXP      sModel,
@@ -12095,7 +12887,7 @@ SEXP rcLSgetChanceConstraint(SEXP      sModel,
                             "paiCons","pdProb","pdObjWeight"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 6;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12151,7 +12943,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetSampleSizes(SEXP      sModel)
@@ -12167,7 +12959,7 @@ SEXP rcLSgetSampleSizes(SEXP      sModel)
     char      *Names[2] = {"ErrorCode","panSampleSize"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12196,7 +12988,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetConstraintStages(SEXP      sModel)
@@ -12212,7 +13004,7 @@ SEXP rcLSgetConstraintStages(SEXP      sModel)
     char      *Names[2] = {"ErrorCode","panStage"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12241,7 +13033,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetVariableStages(SEXP      sModel)
@@ -12257,7 +13049,7 @@ SEXP rcLSgetVariableStages(SEXP      sModel)
     char      *Names[2] = {"ErrorCode","panStage"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12286,7 +13078,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetStocRowIndices(SEXP      sModel)
@@ -12302,7 +13094,7 @@ SEXP rcLSgetStocRowIndices(SEXP      sModel)
     char      *Names[2] = {"ErrorCode","paiSrows"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12331,7 +13123,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetStocParRG(SEXP      sModel,
@@ -12354,7 +13146,7 @@ SEXP rcLSsetStocParRG(SEXP      sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12381,7 +13173,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetScenarioModel(SEXP      sModel,
@@ -12393,6 +13185,7 @@ SEXP rcLSgetScenarioModel(SEXP      sModel,
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
+    pLSmodel  pdModel = NULL;
     prLSmodel prdModel = NULL;
     SEXP      sprdModel = R_NilValue;
     int       nProtect = 0;
@@ -12402,25 +13195,30 @@ SEXP rcLSgetScenarioModel(SEXP      sModel,
 
     CHECK_MODEL_ERROR;
 
-    prdModel = (prLSmodel)malloc(sizeof(rLSmodel)*1);
+    pdModel = LSgetScenarioModel(pModel,jScenario,pnErrorCode);
+    CHECK_ERRCODE;
+
+    prdModel = rNewModel(pdModel,prModel->prEnv);
     if(prdModel == NULL)
     {
-        return R_NilValue;
+        LSdeleteModel(&pdModel);
+        *pnErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
     }
 
-    prdModel->pModel = LSgetScenarioModel(pModel,jScenario,pnErrorCode);
-    CHECK_ERRCODE;
-
     SET_PRINT_LOG(prdModel->pModel,*pnErrorCode);
     CHECK_ERRCODE;
 
-    SET_MODEL_CALLBACK(prdModel->pModel,*pnErrorCode);
+    SET_MODEL_CALLBACK(prdModel->pModel,prdModel,*pnErrorCode);
     CHECK_ERRCODE;
 
-    sprdModel = R_MakeExternalPtr(prdModel,R_NilValue,R_NilValue);
+    PROTECT(sprdModel = R_MakeExternalPtr(prdModel,R_NilValue,R_ExternalPtrProtected(sModel)));
+    nProtect += 1;
 
     R_SetExternalPtrTag(sprdModel,tagLSprob);
 
+    R_RegisterCFinalizerEx(sprdModel,rFinalizeModel,TRUE);
+
 ErrorReturn:
 
     UNPROTECT(nProtect);
@@ -12429,6 +13227,10 @@ ErrorReturn:
     {
         Rprintf("\nFail to get ScenarioModel (error %d)\n",*pnErrorCode);
         R_FlushConsole();
+        if(prdModel != NULL)
+        {
+            rFreeModel(prdModel);
+        }
         return R_NilValue;
     }
     else
@@ -12448,7 +13250,7 @@ SEXP rcLSfreeStocMemory(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12464,7 +13266,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfreeStocHashMemory(SEXP      sModel)
@@ -12478,7 +13280,7 @@ SEXP rcLSfreeStocHashMemory(SEXP      sModel)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12494,7 +13296,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetModelStocParameterInt(SEXP      sModel,
@@ -12512,7 +13314,7 @@ SEXP rcLSgetModelStocParameterInt(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12541,7 +13343,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetModelStocParameterDou(SEXP      sModel,
@@ -12559,7 +13361,7 @@ SEXP rcLSgetModelStocParameterDou(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12588,7 +13390,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetModelStocParameterChar(SEXP      sModel,
@@ -12606,7 +13408,7 @@ SEXP rcLSgetModelStocParameterChar(SEXP      sModel,
     char      *Names[2] = {"ErrorCode","pachResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12638,7 +13440,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetModelStocParameterInt(SEXP       sModel,
@@ -12656,7 +13458,7 @@ SEXP rcLSsetModelStocParameterInt(SEXP       sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12674,7 +13476,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetModelStocParameterDou(SEXP       sModel,
@@ -12692,7 +13494,7 @@ SEXP rcLSsetModelStocParameterDou(SEXP       sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12710,7 +13512,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetModelStocParameterChar(SEXP       sModel,
@@ -12728,7 +13530,7 @@ SEXP rcLSsetModelStocParameterChar(SEXP       sModel,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12746,7 +13548,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetEnvStocParameterInt(SEXP      sEnv,
@@ -12764,7 +13566,7 @@ SEXP rcLSgetEnvStocParameterInt(SEXP      sEnv,
     char      *Names[2] = {"ErrorCode","pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12793,7 +13595,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetEnvStocParameterDou(SEXP      sEnv,
@@ -12811,7 +13613,7 @@ SEXP rcLSgetEnvStocParameterDou(SEXP      sEnv,
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12840,7 +13642,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetEnvStocParameterChar(SEXP      sEnv,
@@ -12858,7 +13660,7 @@ SEXP rcLSgetEnvStocParameterChar(SEXP      sEnv,
     char      *Names[2] = {"ErrorCode","pachResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12890,7 +13692,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetEnvStocParameterInt(SEXP      sEnv,
@@ -12908,7 +13710,7 @@ SEXP rcLSsetEnvStocParameterInt(SEXP      sEnv,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12926,7 +13728,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetEnvStocParameterDou(SEXP      sEnv,
@@ -12944,7 +13746,7 @@ SEXP rcLSsetEnvStocParameterDou(SEXP      sEnv,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12962,7 +13764,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetEnvStocParameterChar(SEXP      sEnv,
@@ -12980,7 +13782,7 @@ SEXP rcLSsetEnvStocParameterChar(SEXP      sEnv,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -12998,7 +13800,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -13015,7 +13817,8 @@ SEXP rcLSsampCreate(SEXP sEnv,
     SEXP        sSample = R_NilValue;
     int         nDistType = Rf_asInteger(snDistType);
 
-    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv)
+    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv &&
+       R_ExternalPtrAddr(sEnv) != NULL)
     {
         prEnv = (prLSenv)R_ExternalPtrAddr(sEnv);
         pEnv = prEnv->pEnv;
@@ -13039,22 +13842,28 @@ SEXP rcLSsampCreate(SEXP sEnv,
     {
         Rprintf("Failed to create Sample object (error %d)\n",nErrorCode);
         R_FlushConsole();
+        free(prSample);
         return R_NilValue;
     }
 
     prSample->pSample = pSample;
+    prSample->prEnv = prEnv;
+    prEnv->nRefs++;
 
-    sSample = R_MakeExternalPtr(prSample,R_NilValue,R_NilValue);
+    PROTECT(sSample = R_MakeExternalPtr(prSample,R_NilValue,sEnv));
 
     R_SetExternalPtrTag(sSample,tagLSsample);
 
+    R_RegisterCFinalizerEx(sSample,rFinalizeSample,TRUE);
+
+    UNPROTECT(1);
+
     return sSample;
 }
 
 SEXP rcLSsampDelete(SEXP  sSample)
 {
     prLSsample   prSample;
-    pLSsample    pSample;
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -13062,17 +13871,21 @@ SEXP rcLSsampDelete(SEXP  sSample)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_SAMPLE_ERROR;
+    //deleting an already deleted sample is not an error
+    if(sSample != R_NilValue && R_ExternalPtrTag(sSample) == tagLSsample &&
+       R_ExternalPtrAddr(sSample) == NULL)
+    {
+        goto ErrorReturn;
+    }
 
-    *pnErrorCode = LSsampDelete(&pSample);
-    CHECK_ERRCODE;
+    CHECK_SAMPLE_HANDLE;
 
-    prSample->pSample = NULL;
+    *pnErrorCode = rFreeSample(prSample);
 
     R_ClearExternalPtr(sSample);
 
@@ -13083,7 +13896,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampSetDistrParam(SEXP  sSample,
@@ -13101,7 +13914,7 @@ SEXP rcLSsampSetDistrParam(SEXP  sSample,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13117,7 +13930,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampGetDistrParam(SEXP  sSample,
@@ -13135,7 +13948,7 @@ SEXP rcLSsampGetDistrParam(SEXP  sSample,
     char      *Names[2] = {"ErrorCode","pdValue"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13164,7 +13977,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampEvalDistr(SEXP  sSample,
@@ -13184,7 +13997,7 @@ SEXP rcLSsampEvalDistr(SEXP  sSample,
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13213,7 +14026,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampEvalUserDistr(SEXP  sSample,
@@ -13235,7 +14048,7 @@ SEXP rcLSsampEvalUserDistr(SEXP  sSample,
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13264,7 +14077,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampSetRG(SEXP  sSample,
@@ -13281,7 +14094,7 @@ SEXP rcLSsampSetRG(SEXP  sSample,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13298,7 +14111,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampGenerate(SEXP  sSample,
@@ -13316,7 +14129,7 @@ SEXP rcLSsampGenerate(SEXP  sSample,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13332,7 +14145,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampGetPoints(SEXP  sSample)
@@ -13350,7 +14163,7 @@ SEXP rcLSsampGetPoints(SEXP  sSample)
     char      *Names[3] = {"ErrorCode","pnSampSize","padXval"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13387,7 +14200,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampLoadPoints(SEXP  sSample,
@@ -13405,7 +14218,7 @@ SEXP rcLSsampLoadPoints(SEXP  sSample,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13421,7 +14234,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampGetCIPoints(SEXP  sSample)
@@ -13439,7 +14252,7 @@ SEXP rcLSsampGetCIPoints(SEXP  sSample)
     char      *Names[3] = {"ErrorCode","pnSampSize","padXval"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 3;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13476,7 +14289,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampLoadDiscretePdfTable(SEXP  sSample,
@@ -13496,7 +14309,7 @@ SEXP rcLSsampLoadDiscretePdfTable(SEXP  sSample,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13512,7 +14325,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampGetDiscretePdfTable(SEXP  sSample)
@@ -13532,7 +14345,7 @@ SEXP rcLSsampGetDiscretePdfTable(SEXP  sSample)
     char      *Names[4] = {"ErrorCode","pnLen", "padProb","padVals"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 4;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13575,7 +14388,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampGetIInfo(SEXP      sSample,
@@ -13593,7 +14406,7 @@ SEXP rcLSsampGetIInfo(SEXP      sSample,
     char      *Names[2] = {"ErrorCode","pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13622,7 +14435,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsampGetDInfo(SEXP      sSample,
@@ -13640,7 +14453,7 @@ SEXP rcLSsampGetDInfo(SEXP      sSample,
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13669,7 +14482,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -13686,7 +14499,8 @@ SEXP rcLScreateRG(SEXP sEnv,
     SEXP         sRG = R_NilValue;
     int          nMethod = Rf_asInteger(snMethod);
 
-    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv)
+    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv &&
+       R_ExternalPtrAddr(sEnv) != NULL)
     {
         prEnv = (prLSenv)R_ExternalPtrAddr(sEnv);
         pEnv = prEnv->pEnv;
@@ -13708,11 +14522,17 @@ SEXP rcLScreateRG(SEXP sEnv,
     pRG = LScreateRG(pEnv,nMethod);
 
     prRG->pRG = pRG;
+    prRG->prEnv = prEnv;
+    prEnv->nRefs++;
 
-    sRG = R_MakeExternalPtr(prRG,R_NilValue,R_NilValue);
+    PROTECT(sRG = R_MakeExternalPtr(prRG,R_NilValue,sEnv));
 
     R_SetExternalPtrTag(sRG,tagLSrandGen);
 
+    R_RegisterCFinalizerEx(sRG,rFinalizeRG,TRUE);
+
+    UNPROTECT(1);
+
     return sRG;
 }
 
@@ -13727,7 +14547,8 @@ SEXP rcLScreateRGMT(SEXP sEnv,
     SEXP         sRG = R_NilValue;
     int          nMethod = Rf_asInteger(snMethod);
 
-    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv)
+    if(sEnv != R_NilValue && R_ExternalPtrTag(sEnv) == tagLSenv &&
+       R_ExternalPtrAddr(sEnv) != NULL)
     {
         prEnv = (prLSenv)R_ExternalPtrAddr(sEnv);
         pEnv = prEnv->pEnv;
@@ -13749,11 +14570,17 @@ SEXP rcLScreateRGMT(SEXP sEnv,
     pRG = LScreateRGMT(pEnv,nMethod);
 
     prRG->pRG = pRG;
+    prRG->prEnv = prEnv;
+    prEnv->nRefs++;
 
-    sRG = R_MakeExternalPtr(prRG,R_NilValue,R_NilValue);
+    PROTECT(sRG = R_MakeExternalPtr(prRG,R_NilValue,sEnv));
 
     R_SetExternalPtrTag(sRG,tagLSrandGen);
 
+    R_RegisterCFinalizerEx(sRG,rFinalizeRG,TRUE);
+
+    UNPROTECT(1);
+
     return sRG;
 }
 
@@ -13770,7 +14597,7 @@ SEXP rcLSgetDoubleRV(SEXP   sRG)
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13799,7 +14626,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetInt32RV(SEXP   sRG,
@@ -13819,7 +14646,7 @@ SEXP rcLSgetInt32RV(SEXP   sRG,
     char      *Names[2] = {"ErrorCode","pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13848,7 +14675,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetRGSeed(SEXP   sRG,
@@ -13864,7 +14691,7 @@ SEXP rcLSsetRGSeed(SEXP   sRG,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13880,13 +14707,12 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSdisposeRG(SEXP   sRG)
 {
     prLSrandGen   prRG;
-    pLSrandGen    pRG;
 
     int       *pnErrorCode;
     SEXP      spnErrorCode = R_NilValue;
@@ -13894,16 +14720,21 @@ SEXP rcLSdisposeRG(SEXP   sRG)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
 
-    CHECK_RG_ERROR;
+    //disposing an already disposed generator is not an error
+    if(sRG != R_NilValue && R_ExternalPtrTag(sRG) == tagLSrandGen &&
+       R_ExternalPtrAddr(sRG) == NULL)
+    {
+        goto ErrorReturn;
+    }
 
-    LSdisposeRG(&pRG);
+    CHECK_RG_HANDLE;
 
-    prRG->pRG = NULL;
+    rFreeRG(prRG);
 
     R_ClearExternalPtr(sRG);
 
@@ -13914,7 +14745,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetDistrParamRG(SEXP   sRG,
@@ -13932,7 +14763,7 @@ SEXP rcLSsetDistrParamRG(SEXP   sRG,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13948,7 +14779,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSsetDistrRG(SEXP   sRG,
@@ -13964,7 +14795,7 @@ SEXP rcLSsetDistrRG(SEXP   sRG,
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -13980,7 +14811,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetDistrRV(SEXP   sRG)
@@ -13996,7 +14827,7 @@ SEXP rcLSgetDistrRV(SEXP   sRG)
     char      *Names[2] = {"ErrorCode","pdResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -14025,7 +14856,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetInitSeed(SEXP   sRG)
@@ -14041,7 +14872,7 @@ SEXP rcLSgetInitSeed(SEXP   sRG)
     char      *Names[2] = {"ErrorCode","pnResult"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -14070,7 +14901,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSgetRGNumThreads(SEXP   sRG)
@@ -14086,7 +14917,7 @@ SEXP rcLSgetRGNumThreads(SEXP   sRG)
     char      *Names[2] = {"ErrorCode","pnThreads"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -14115,7 +14946,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP rcLSfillRGBuffer(SEXP   sRG)
@@ -14129,7 +14960,7 @@ SEXP rcLSfillRGBuffer(SEXP   sRG)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -14145,7 +14976,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -14181,7 +15012,7 @@ SEXP rcLSsolveFileLP(SEXP      sModel,
                            "pnNoOfColsMps","pnErrorLine"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 5;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -14234,7 +15065,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /********************************************************
@@ -14257,7 +15088,7 @@ SEXP rcLSsolveMipBnp(SEXP      sModel,
     char      *Names[2] = {"ErrorCode", "pnStatus"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 2;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
 
     //errorcode item
     INI_ERR_CODE;
@@ -14286,7 +15117,7 @@ ErrorReturn:
 
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 
@@ -14329,7 +15160,7 @@ SEXP rcLSwriteVarPriorities(SEXP spModel,SEXP spszFname,SEXP snMode) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14358,7 +15189,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14390,7 +15221,7 @@ SEXP rcLSaddObjPool(SEXP spModel,SEXP spadC,SEXP smObjSense,SEXP smRank,SEXP sdR
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14425,7 +15256,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14453,7 +15284,7 @@ SEXP rcLSwriteTunerConfigString(SEXP spEnv,SEXP sszJsonString,SEXP sszJsonFile)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14477,7 +15308,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14507,7 +15338,7 @@ SEXP rcLSwriteTunerParameters(SEXP spEnv,SEXP sszFile,SEXP sjInstance,SEXP smCri
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14533,7 +15364,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14560,7 +15391,7 @@ SEXP rcLSwriteParameterAsciiDoc(SEXP spEnv,SEXP spszFileName) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14582,7 +15413,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14609,7 +15440,7 @@ SEXP rcLSaddTunerInstance(SEXP spEnv,SEXP sszFile) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14631,7 +15462,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14659,7 +15490,7 @@ SEXP rcLSaddTunerOption(SEXP spEnv,SEXP sszKey,SEXP sdValue) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14683,7 +15514,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14711,7 +15542,7 @@ SEXP rcLSaddTunerStrOption(SEXP spEnv,SEXP sszKey,SEXP sszValue) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14735,7 +15566,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14761,7 +15592,7 @@ SEXP rcLSaddTunerZDynamic(SEXP spEnv,SEXP siParam) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14783,7 +15614,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14813,7 +15644,7 @@ SEXP rcLSaddTunerZStatic(SEXP spEnv,SEXP sjGroupId,SEXP siParam,SEXP sdValue) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14839,7 +15670,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14864,7 +15695,7 @@ SEXP rcLSclearTuner(SEXP spEnv) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14884,7 +15715,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14908,7 +15739,7 @@ SEXP rcLSdisplayTunerResults(SEXP spEnv) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14928,7 +15759,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -14953,7 +15784,7 @@ SEXP rcLSgetTunerConfigString(SEXP spEnv) {
   char      *Names[2] = {"ErrorCode","spszJsonString"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -14980,7 +15811,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 1, spszJsonString);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15008,7 +15839,7 @@ SEXP rcLSgetTunerOption(SEXP spEnv,SEXP sszkey) {
   char      *Names[2] = {"ErrorCode","pdval"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15036,7 +15867,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 1, spdval);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15069,7 +15900,7 @@ SEXP rcLSgetTunerResult(SEXP spEnv,SEXP sszkey,SEXP sjInstance,SEXP skConfig) {
   char      *Names[2] = {"ErrorCode","pdval"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15101,7 +15932,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 1, spdval);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15122,7 +15953,7 @@ SEXP rcLSgetTunerSpace(SEXP spEnv) {
   char      *Names[3] = {"ErrorCode","panParamId","numParam"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 3;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15157,7 +15988,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 2, snumParam);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15186,7 +16017,7 @@ SEXP rcLSgetTunerStrOption(SEXP spEnv,SEXP sszkey) {
   char      *Names[2] = {"ErrorCode","sszval"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15211,7 +16042,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 1, sszval);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15237,7 +16068,7 @@ SEXP rcLSloadTunerConfigFile(SEXP spEnv,SEXP sszJsonFile) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15259,7 +16090,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15285,7 +16116,7 @@ SEXP rcLSloadTunerConfigString(SEXP spEnv,SEXP sszJsonString) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15307,7 +16138,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15331,7 +16162,7 @@ SEXP rcLSprintTuner(SEXP spEnv) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15351,7 +16182,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15375,7 +16206,7 @@ SEXP rcLSresetTuner(SEXP spEnv) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15395,7 +16226,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15419,7 +16250,7 @@ SEXP rcLSrunTuner(SEXP spEnv) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15439,7 +16270,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15465,7 +16296,7 @@ SEXP rcLSrunTunerFile(SEXP spEnv,SEXP sszJsonFile) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15487,7 +16318,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15513,7 +16344,7 @@ SEXP rcLSrunTunerString(SEXP spEnv,SEXP sszJsonString) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15535,7 +16366,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15563,7 +16394,7 @@ SEXP rcLSsetTunerOption(SEXP spEnv,SEXP sszKey,SEXP sdval) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15587,7 +16418,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15615,7 +16446,7 @@ SEXP rcLSsetTunerStrOption(SEXP spEnv,SEXP sszKey,SEXP sszval) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15639,7 +16470,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15668,7 +16499,7 @@ SEXP rcLSwriteMPXFile(SEXP spModel,SEXP spszFname,SEXP smMask) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15697,7 +16528,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15731,7 +16562,7 @@ SEXP rcLSapplyLtf(SEXP spModel,SEXP spanNewColIdx,SEXP spanNewRowIdx,SEXP spanNe
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15772,7 +16603,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15799,7 +16630,7 @@ SEXP rcLSbnbSolve(SEXP spModel,SEXP spszFname) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15826,7 +16657,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15856,7 +16687,7 @@ SEXP rcLScalcConFunc(SEXP spModel,SEXP siRow,SEXP spadPrimal) {
   char      *Names[2] = {"ErrorCode","padSlacks"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15891,7 +16722,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spadSlacks);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15926,7 +16757,7 @@ SEXP rcLScalcConGrad(SEXP spModel,SEXP sirow,SEXP spadPrimal,SEXP snParList,SEXP
   char      *Names[2] = {"ErrorCode","padParGrad"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -15967,7 +16798,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spadParGrad);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -15993,7 +16824,7 @@ SEXP rcLSwriteNLSolution(SEXP spModel,SEXP spszFname) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -16021,7 +16852,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -16047,7 +16878,7 @@ SEXP rcLSwriteEnvParameter(SEXP spEnv,SEXP spszFname) {
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   // zero-out temp vectors
   ZERO_BUF(20);
@@ -16070,7 +16901,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -16097,7 +16928,7 @@ SEXP rcLSreadCBFFile(SEXP spModel,SEXP spszFname)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16108,6 +16939,8 @@ SEXP rcLSreadCBFFile(SEXP spModel,SEXP spszFname)
   sbuf[2] = pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
 
   CHECK_MODEL_ERROR;
+
+    rDropNameIndex(prModel);
   LSgetInfo(pModel, LS_IINFO_NUM_VARS, &n);
   LSgetInfo(pModel, LS_IINFO_NUM_CONS, &m);
   LSgetInfo(pModel, LS_IINFO_NUM_NONZ, &nz);
@@ -16127,7 +16960,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16153,7 +16986,7 @@ SEXP rcLSreadMPXFile(SEXP spModel	,SEXP spszFname)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16164,6 +16997,8 @@ SEXP rcLSreadMPXFile(SEXP spModel	,SEXP spszFname)
   sbuf[2] = pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
 
   CHECK_MODEL_ERROR;
+
+    rDropNameIndex(prModel);
   LSgetInfo(pModel, LS_IINFO_NUM_VARS, &n);
   LSgetInfo(pModel, LS_IINFO_NUM_CONS, &m);
   LSgetInfo(pModel, LS_IINFO_NUM_NONZ, &nz);
@@ -16183,7 +17018,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16209,7 +17044,7 @@ SEXP rcLSreadNLFile(SEXP spModel,SEXP spszFname)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16220,6 +17055,8 @@ SEXP rcLSreadNLFile(SEXP spModel,SEXP spszFname)
   sbuf[2] = pszFname = (char *) CHAR(STRING_ELT(spszFname,0));
 
   CHECK_MODEL_ERROR;
+
+    rDropNameIndex(prModel);
   LSgetInfo(pModel, LS_IINFO_NUM_VARS, &n);
   LSgetInfo(pModel, LS_IINFO_NUM_CONS, &m);
   LSgetInfo(pModel, LS_IINFO_NUM_NONZ, &nz);
@@ -16239,7 +17076,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16267,7 +17104,7 @@ SEXP rcLSwriteDualLINDOFile(SEXP spModel,SEXP spszFname,SEXP snObjSense)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16299,7 +17136,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16327,7 +17164,7 @@ SEXP rcLSgetGOPVariablePriority(SEXP spModel,SEXP sndxVar)
   char      *Names[2] = {"ErrorCode","pnPriority"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
   SEXP      spnPriority = R_NilValue;;
 
 
@@ -16363,7 +17200,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spnPriority);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -16393,7 +17230,7 @@ SEXP rcLSsetXSolverLibrary(SEXP spEnv,SEXP smVendorId,SEXP sszLibrary)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16420,7 +17257,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16448,7 +17285,7 @@ SEXP rcLSsetGOPVariablePriority(SEXP spModel,SEXP sndxVar,SEXP snPriority)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16480,7 +17317,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16510,7 +17347,7 @@ SEXP rcLSsetObjPoolParam(SEXP spModel,SEXP snObjIndex,SEXP smInfo,SEXP sdValue)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16544,7 +17381,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16572,7 +17409,7 @@ SEXP rcLSsetSETSStatei(SEXP spModel,SEXP siSet,SEXP smState)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16604,7 +17441,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16630,7 +17467,7 @@ SEXP rcLSremObjPool(SEXP spModel,SEXP snObjIndex)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16660,7 +17497,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16690,7 +17527,7 @@ SEXP rcLSrepairQterms(SEXP spModel,SEXP snCons,SEXP spaiCons,SEXP spaiType)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16728,7 +17565,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -16753,7 +17590,7 @@ SEXP rcLSloadLicenseString(SEXP spszFname)
   char      *Names[2] = {"ErrorCode","pachLicense"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
   SEXP      spachLicense = R_NilValue;
 
 
@@ -16783,7 +17620,7 @@ SEXP rcLSloadLicenseString(SEXP spszFname)
     SET_VECTOR_ELT(rList, 1, spachLicense);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -16820,7 +17657,7 @@ SEXP rcLSloadALLDIFFData(SEXP spModel,SEXP snALLDIFF,SEXP spaiAlldiffDim,SEXP sp
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16870,7 +17707,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16898,7 +17735,7 @@ SEXP rcLSloadIISPriorities(SEXP spModel,SEXP spanRprior,SEXP spanCprior)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16934,7 +17771,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -16974,7 +17811,7 @@ SEXP rcLSloadNLPDense(SEXP spModel,SEXP snCons,SEXP snVars,SEXP sdObjSense,SEXP
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -16992,6 +17829,9 @@ SEXP rcLSloadNLPDense(SEXP spModel,SEXP snCons,SEXP snVars,SEXP sdObjSense,SEXP
   MAKE_REAL_ARRAY(padU,spadU);
 
   CHECK_MODEL_ERROR;
+
+  rDropNameIndex(prModel);
+
   LSgetInfo(pModel, LS_IINFO_NUM_VARS, &n);
   LSgetInfo(pModel, LS_IINFO_NUM_CONS, &m);
   LSgetInfo(pModel, LS_IINFO_NUM_NONZ, &nz);
@@ -17024,7 +17864,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17052,7 +17892,7 @@ SEXP rcLSloadSolutionAt(SEXP spModel,SEXP snObjIndex,SEXP snSolIndex)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -17084,7 +17924,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17110,7 +17950,7 @@ SEXP rcLSmodifyObjConstant(SEXP spModel,SEXP sdObjConst)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -17140,7 +17980,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17168,7 +18008,7 @@ SEXP rcLSreadMPXStream(SEXP spModel,SEXP spszStream,SEXP snStreamLen)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -17180,6 +18020,8 @@ SEXP rcLSreadMPXStream(SEXP spModel,SEXP spszStream,SEXP snStreamLen)
   ibuf[3] = nStreamLen = Rf_asInteger(snStreamLen);
 
   CHECK_MODEL_ERROR;
+
+    rDropNameIndex(prModel);
   LSgetInfo(pModel, LS_IINFO_NUM_VARS, &n);
   LSgetInfo(pModel, LS_IINFO_NUM_CONS, &m);
   LSgetInfo(pModel, LS_IINFO_NUM_NONZ, &nz);
@@ -17200,7 +18042,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -17229,7 +18071,7 @@ SEXP rcLSsetMIPCCStrategy(SEXP spModel,SEXP snRunId,SEXP sszParamFile)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -17263,7 +18105,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17289,7 +18131,7 @@ SEXP rcLSgetNextBestSol(SEXP spModel)
   char      *Names[2] = {"ErrorCode","pnModStatus"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnModStatus= R_NilValue;
 
@@ -17324,7 +18166,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spnModStatus);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17352,7 +18194,7 @@ SEXP rcLSgetNnzData(SEXP spModel,SEXP smStat)
   char      *Names[2] = {"ErrorCode","panOutput"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spanOutput= R_NilValue;
 
@@ -17396,7 +18238,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spanOutput);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17424,7 +18266,7 @@ SEXP rcLSgetObjectiveRanges(SEXP spModel)
   char      *Names[3] = {"ErrorCode","padDec","padInc"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 3;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spadDec= R_NilValue;
   SEXP spadInc= R_NilValue;
@@ -17466,7 +18308,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 2, spadInc);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17494,7 +18336,7 @@ SEXP rcLSgetObjPoolNumSol(SEXP spModel,SEXP snObjIndex)
   char      *Names[2] = {"ErrorCode","pNumSol"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spNumSol= R_NilValue;
 
@@ -17531,7 +18373,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spNumSol);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17569,7 +18411,7 @@ SEXP rcLSgetPOSDData(SEXP spModel)
   char      *Names[8] = {"ErrorCode","pinPOSD","paiPOSDdim","paiPOSDnnz","paiPOSDbeg","paiPOSDrowndx","paiPOSDcolndx","paiPOSDvarndx"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 8;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spinPOSD= R_NilValue;
   SEXP spaiPOSDdim= R_NilValue;
@@ -17653,7 +18495,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 7, spaiPOSDvarndx);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17689,7 +18531,7 @@ SEXP rcLSgetPOSDDatai(SEXP spModel,SEXP siPOSD)
   char      *Names[6] = {"ErrorCode","piPOSDdim","piPOSDnnz","paiPOSDrowndx","paiPOSDcolndx","paiPOSDvarndx"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 6;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spiPOSDdim= R_NilValue;
   SEXP spiPOSDnnz= R_NilValue;
@@ -17755,7 +18597,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 5, spaiPOSDvarndx);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17785,7 +18627,7 @@ SEXP rcLSgetProgressIInfo(SEXP spModel,SEXP snLocation,SEXP snQuery)
   char      *Names[2] = {"ErrorCode","pvValue"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
   SEXP spvValue= R_NilValue;
@@ -17824,7 +18666,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 1, spvValue);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -17855,7 +18697,7 @@ SEXP rcLSgetProgressDInfo(SEXP spModel,SEXP snLocation,SEXP snQuery)
   char      *Names[2] = {"ErrorCode","pvValue"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
   SEXP spvValue= R_NilValue;
@@ -17894,7 +18736,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 1, spvValue);
 
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 /*
@@ -17920,7 +18762,7 @@ SEXP rcLSgetObjective(SEXP spModel)
   char      *Names[2] = {"ErrorCode","pdObj"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spdObj= R_NilValue;
 
@@ -17954,7 +18796,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spdObj);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -17983,7 +18825,7 @@ SEXP rcLScalcObjFunc(SEXP spModel,SEXP spadPrimal)
   char      *Names[3] = {"ErrorCode","pdObjval"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 3;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spdObjval= R_NilValue;
 
@@ -18019,7 +18861,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spdObjval);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18052,7 +18894,7 @@ SEXP rcLScalcObjGrad(SEXP spModel,SEXP spadPrimal,SEXP snParList, SEXP spaiParLi
   char      *Names[2] = {"ErrorCode","padParGrad"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spadParGrad= R_NilValue;
 
@@ -18092,7 +18934,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spadParGrad);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18123,7 +18965,7 @@ SEXP rcLScheckQterms(SEXP spModel,SEXP snCons,SEXP spaiCons)
   char      *Names[2] = {"ErrorCode","paiType"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spaiType= R_NilValue;
 
@@ -18164,7 +19006,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spaiType);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18199,7 +19041,7 @@ SEXP rcLSdisplayBlockStructure(SEXP spModel)
   char      *Names[6] = {"ErrorCode","pnBlock","panNewColIdx","panNewRowIdx","panNewColPos","panNewRowPos"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 6;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnBlock= R_NilValue;
   SEXP spanNewColIdx= R_NilValue;
@@ -18266,7 +19108,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 5, spanNewRowPos);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18303,7 +19145,7 @@ SEXP rcLSdoBTRAN(SEXP spModel,SEXP spcYnz,SEXP spaiY,SEXP spadY)
   char      *Names[4] = {"ErrorCode","pcXnz","paiX","padX"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 4;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spcXnz= R_NilValue;
   SEXP spaiX= R_NilValue;
@@ -18370,7 +19212,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 3, spadX);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18407,7 +19249,7 @@ SEXP rcLSdoFTRAN(SEXP spModel,SEXP spcYnz,SEXP spaiY,SEXP spadY)
   char      *Names[4] = {"ErrorCode","pcXnz","paiX","padX"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 4;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spcXnz= R_NilValue;
   SEXP spaiX= R_NilValue;
@@ -18474,7 +19316,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 3, spadX);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18507,7 +19349,7 @@ SEXP rcLSfindLtf(SEXP spModel)
   char      *Names[5] = {"ErrorCode","panNewColIdx","panNewRowIdx","panNewColPos","panNewRowPos"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 5;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spanNewColIdx= R_NilValue;
   SEXP spanNewRowIdx= R_NilValue;
@@ -18563,7 +19405,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 4, spanNewRowPos);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18588,7 +19430,7 @@ SEXP rcLSfreeObjPool(SEXP spModel)
   char      *Names[1] = {"ErrorCode"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -18617,7 +19459,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18654,7 +19496,7 @@ SEXP rcLSgetALLDIFFData(SEXP spModel)
   char      *Names[7] = {"ErrorCode","pinALLDIFF","paiAlldiffDim","paiAlldiffL","paiAlldiffU","paiAlldiffBeg","paiAlldiffVar"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 7;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spinALLDIFF= R_NilValue;
   SEXP spaiAlldiffDim= R_NilValue;
@@ -18731,7 +19573,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 6, spaiAlldiffVar);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18766,7 +19608,7 @@ SEXP rcLSgetALLDIFFDatai(SEXP spModel,SEXP siALLDIFF)
   char      *Names[5] = {"ErrorCode","piAlldiffDim","piAlldiffL","piAlldiffU","paiAlldiffVar"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 5;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spiAlldiffDim= R_NilValue;
   SEXP spiAlldiffL= R_NilValue;
@@ -18826,7 +19668,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 4, spaiAlldiffVar);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -18873,7 +19715,7 @@ SEXP rcLSgetDimensions(SEXP spModel)
   char      *Names[12] = {"ErrorCode","pnVars","pnCons","pnCones","pnAnnz","pnQCnnz","pnConennz","pnNLPnnz","pnNLPobjnnz","pnVarNamelen","pnConNamelen","pnConeNamelen"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 12;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnVars= R_NilValue;
   SEXP spnCons= R_NilValue;
@@ -18978,7 +19820,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 11, spnConeNamelen);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -19013,7 +19855,7 @@ SEXP rcLSgetDualMIPsolution(SEXP spModel)
   char      *Names[6] = {"ErrorCode","padPrimal","padDual","padRedcosts","panCstatus","panRstatus"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 6;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spadPrimal= R_NilValue;
   SEXP spadDual= R_NilValue;
@@ -19076,7 +19918,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 5, spanRstatus);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -19109,7 +19951,7 @@ SEXP rcLSgetDuplicateColumns(SEXP spModel,SEXP snCheckVals)
   char      *Names[4] = {"ErrorCode","pnSets","paiSetsBeg","paiCols"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 4;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnSets= R_NilValue;
   SEXP spaiSetsBeg= R_NilValue;
@@ -19161,7 +20003,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 3, spaiCols);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -19199,7 +20041,7 @@ SEXP rcLSgetJac(SEXP spModel,SEXP spadX)
   char      *Names[6] = {"ErrorCode","pnJnonzeros","pnJobjnnz","paiJrows","paiJcols","padJcoef"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 6;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnJnonzeros= R_NilValue;
   SEXP spnJobjnnz= R_NilValue;
@@ -19269,7 +20111,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 6, spadX);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -19301,7 +20143,7 @@ SEXP rcLSgetIISSETs(SEXP spModel)
   char      *Names[4] = {"ErrorCode","pnSuf_set","pnIIS_set","paiSets"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 4;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnSuf_set= R_NilValue;
   SEXP spnIIS_set= R_NilValue;
@@ -19356,7 +20198,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 3, spaiSets);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -19387,7 +20229,7 @@ SEXP rcLSgetIISInts(SEXP spModel)
   char      *Names[4] = {"ErrorCode","pnSuf_xnt","pnIIS_xnt","paiVars"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 4;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnSuf_xnt= R_NilValue;
   SEXP spnIIS_xnt= R_NilValue;
@@ -19442,7 +20284,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 3, spaiVars);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -19480,7 +20322,7 @@ SEXP rcLSgetHess(SEXP spModel,SEXP spadX)
   char      *Names[6] = {"ErrorCode","pnHnonzeros","paiHrows","paiHcol1","paiHcol2","padHcoef"};
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 6;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spnHnonzeros= R_NilValue;
   SEXP spaiHrows= R_NilValue;
@@ -19549,29 +20391,9 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 5, spadHcoef);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
-
-}
-
-typedef struct rLindoData_t {
-    void *pModel;
-    void *sModel;
-    void *pEnv;
-    void *sEnv;
-    void *locFunc;
-    void *locData;
-    void *cbFunc;
-    void *cbData;
-    void *mipFunc;
-    void *mipData;
-    void *Funcalc_func;
-    void *FData;
-    void *Grad_func;
-    void *Grad_func2; //partial gradients
-    void *GData;
-    void *Hessdc_func;
-    void *HDCdata;
-} rLindoData_t;
+  return rReturnList(rList);
+
+}
 
 /*
 * @brief relayLogfunc
@@ -19655,7 +20477,7 @@ SEXP rcLSsetModelLogfunc(SEXP sModel, SEXP sFunc, SEXP sData)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     rLindoData_t *rudata = NULL;
 
     ZERO_BUF(20);
@@ -19664,29 +20486,31 @@ SEXP rcLSsetModelLogfunc(SEXP sModel, SEXP sFunc, SEXP sData)
 
     CHECK_MODEL_ERROR;
 
-    rudata = (rLindoData_t*)LSgetObjHandle(pModel, LS_PTR_MODEL, LS_REF_LOCDATA);
-    if (rudata) {
-        free(rudata);
-    }
+    rudata = prModel->pCbData;
 
     if (!isFunction(sFunc)) {
         if (isNull(sFunc)) {
             *pnErrorCode = errorcode = LSsetModelLogfunc(pModel, NULL, NULL);
+            prModel->bLogOff = TRUE;
+            rSetCbSlot(&rudata->locFunc, R_NilValue);
+            rSetCbSlot(&rudata->locData, R_NilValue);
         }
         else {
             error("rLindo Error: arg#2 is required to be a function");
         }
     }
     else {
-        rudata = malloc(sizeof(rLindoData_t));
-        memset(rudata, 0, sizeof(rLindoData_t));
-        if (sFunc) {
-            rudata->pModel = pModel;
-            rudata->sModel = sModel;
-            rudata->locFunc = sFunc;
-            rudata->locData = sData;
+        rudata->pModel = pModel;
+        rudata->sModel = sModel;
+        rSetCbSlot(&rudata->locFunc, sFunc);
+        rSetCbSlot(&rudata->locData, sData);
+        prModel->bLogOff = FALSE;
+        if (prModel->pLogBuf) {
+            *pnErrorCode = errorcode = LSsetModelLogfunc(pModel, rBufferLog, prModel);
+        }
+        else {
+            *pnErrorCode = errorcode = LSsetModelLogfunc(pModel, relayLogfunc, rudata);
         }
-        *pnErrorCode = errorcode = LSsetModelLogfunc(pModel, relayLogfunc, rudata);
     }
 
 ErrorReturn:
@@ -19696,7 +20520,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /*
@@ -19719,7 +20543,7 @@ SEXP rcLSsetEnvLogfunc(SEXP sEnv, SEXP sFunc, SEXP sData)
   char      *Names[1] = { "ErrorCode" };
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
   rLindoData_t *rudata = NULL;
 
   ZERO_BUF(20);
@@ -19728,29 +20552,27 @@ SEXP rcLSsetEnvLogfunc(SEXP sEnv, SEXP sFunc, SEXP sData)
 
   CHECK_ENV_ERROR;
 
-  rudata = (rLindoData_t*)LSgetObjHandle(pEnv, LS_PTR_ENV, LS_REF_LOCDATA);
-  if (rudata) {
-    free(rudata);
-  }
+  rudata = prEnv->pCbData;
 
   if (!isFunction(sFunc)) {
     if (isNull(sFunc)) {
       *pnErrorCode = errorcode = LSsetEnvLogfunc(pEnv, NULL, NULL);
+      rSetCbSlot(&rudata->locFunc, R_NilValue);
+      rSetCbSlot(&rudata->locData, R_NilValue);
     }
     else {
       error("rLindo Error: arg#2 is required to be a function");
     }
   }
   else {
-    rudata = malloc(sizeof(rLindoData_t));
-    memset(rudata, 0, sizeof(rLindoData_t));
-    if (sFunc) {
-      rudata->pEnv = pEnv;
-      rudata->sEnv = sEnv;
-      rudata->locFunc = sFunc;
-      rudata->locData = sData;
-    }
-    *pnErrorCode = errorcode = LSsetEnvLogfunc(pEnv, relayLogfuncEnv, rudata);
+    rudata->pEnv = pEnv;
+    rudata->sEnv = sEnv;
+    rSetCbSlot(&rudata->locFunc, sFunc);
+    rSetCbSlot(&rudata->locData, sData);
+    /* installed when the running native solves release the log */
+    if (prEnv->nLogHolds == 0) {
+      *pnErrorCode = errorcode = LSsetEnvLogfunc(pEnv, relayLogfuncEnv, rudata);
+    }
   }
 
 ErrorReturn:
@@ -19760,7 +20582,7 @@ ErrorReturn:
   SET_VECTOR_ELT(rList, 0, spnErrorCode);
   UNPROTECT(nProtect + 2);
 
-  return rList;
+  return rReturnList(rList);
 }
 /*
 * @brief relayCallback
@@ -19815,7 +20637,7 @@ SEXP rcLSsetCallback(SEXP sModel, SEXP sFunc, SEXP sData)
     char      *Names[1] = {"ErrorCode"};
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     rLindoData_t *rudata = NULL;
 
     ZERO_BUF(20);
@@ -19824,27 +20646,29 @@ SEXP rcLSsetCallback(SEXP sModel, SEXP sFunc, SEXP sData)
 
     CHECK_MODEL_ERROR;
 
-    rudata = (rLindoData_t*)LSgetObjHandle(pModel, LS_PTR_MODEL, LS_REF_CBDATA);
-    if (rudata) {
-        free(rudata);
-    }
+    rudata = prModel->pCbData;
+
     if (!isFunction(sFunc)) {
         if (isNull(sFunc)) {
-            *pnErrorCode = errorcode = LSsetCallback(pModel, NULL, NULL);
+            //fall back to the default callback unless it was disabled
+            if (prModel->nCbIntervalMs < 0) {
+                *pnErrorCode = errorcode = LSsetCallback(pModel, NULL, NULL);
+            }
+            else {
+                *pnErrorCode = errorcode = LSsetCallback(pModel, (cbFunc_t)rCallBack, prModel);
+            }
+            rSetCbSlot(&rudata->cbFunc, R_NilValue);
+            rSetCbSlot(&rudata->cbData, R_NilValue);
         }
         else {
             error("rLindo Error: arg#2 is required to be a function");
         }
     }
     else {
-        rudata = malloc(sizeof(rLindoData_t));
-        memset(rudata, 0, sizeof(rLindoData_t));
-        if (sFunc) {
-            rudata->pModel = pModel;
-            rudata->sModel = sModel;
-            rudata->cbFunc = sFunc;
-            rudata->cbData = sData;
-        }
+        rudata->pModel = pModel;
+        rudata->sModel = sModel;
+        rSetCbSlot(&rudata->cbFunc, sFunc);
+        rSetCbSlot(&rudata->cbData, sData);
         *pnErrorCode = errorcode = LSsetCallback(pModel, relayCallback, rudata);
     }
 
@@ -19855,7 +20679,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 SEXP lang7(SEXP s, SEXP p1, SEXP p2, SEXP p3, SEXP p4, SEXP p5, SEXP p6)
@@ -19900,30 +20724,258 @@ int    LS_CALLTYPE relayFuncalc(pLSmodel pModel, void    *userdata,
     dvecptr[4] = NUMERIC_POINTER(sdXJBase);  //dXJBase
     *dvecptr[4] = dXJBase;
 
-    errorcode = LSgetInfo(pModel, LS_IINFO_NUM_VARS, &n);
-    if (errorcode) goto ErrorReturn;
-
-#if 1
-    PROTECT(spadPrimal = NEW_NUMERIC(n));
-    nProtect += 1;
-    dvecptr[3] = NUMERIC_POINTER(spadPrimal);  //padPrimal
-    memcpy(dvecptr[3], padPrimal, n * sizeof(double));
-#else
-    PROTECT(spadPrimal = R_MakeExternalPtr(padPrimal,  R_NilValue,  R_NilValue));
+    PROTECT(spadPrimal = rPrimalVector(rudata, padPrimal));
     nProtect += 1;
-#endif
+
     PROTECT(R_fcall = lang7(sFunc, rudata->sModel, sData, snRow, spadPrimal, snJDiff, sdXJBase));
     nProtect += 1;
 
     *pdFuncVal = asReal(eval(R_fcall, R_GlobalEnv));
 
-    R_ClearExternalPtr(spadPrimal);
 
-ErrorReturn:
     UNPROTECT(nProtect);
     return errorcode;
 } /*Funcalc8*/
 
+static unsigned long long rHashPrimal(double *padX, int nVars)
+{
+    unsigned long long nHash = 14695981039346656037ULL;
+    unsigned char      *pByte = (unsigned char*)padX;
+    size_t             k, nBytes = (size_t)nVars * sizeof(double);
+
+    for(k = 0; k < nBytes; k++)
+    {
+        nHash ^= pByte[k];
+        nHash *= 1099511628211ULL;
+    }
+
+    return nHash;
+}
+
+/*
+* @brief relayFuncalcBatch
+* @remark Evaluates the R function once per distinct primal point. The
+*         function returns the objective followed by all constraint rows,
+*         later requests for other rows at the same point are served from
+*         the cache.
+*/
+int    LS_CALLTYPE relayFuncalcBatch(pLSmodel pModel, void    *userdata,
+    int      nRow, double  *padPrimal,
+    int      nJDiff, double  dXJBase,
+    double   *pdFuncVal, void  *pReserved)
+{
+    rLindoData_t     *rudata = (rLindoData_t*)userdata;
+    rLindoFunCache_t *pCache = rudata->pFunCache;
+    int              nVars = rudata->nVars;
+    int              nRows = rudata->nCons + 1;
+    unsigned long long nHash;
+    int              e, nProtect = 0;
+    SEXP             spadPrimal, R_fcall, spadF;
+
+    if(pCache == NULL)
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+
+    nHash = rHashPrimal(padPrimal, nVars);
+    for(e = 0; e < pCache->nEntries; e++)
+    {
+        if(pCache->pbValid[e] && pCache->pnHash[e] == nHash &&
+           memcmp(pCache->padX + (size_t)e * nVars, padPrimal, nVars * sizeof(double)) == 0)
+        {
+            *pdFuncVal = pCache->padF[(size_t)e * nRows + nRow + 1];
+            return 0;
+        }
+    }
+
+    PROTECT(spadPrimal = rPrimalVector(rudata, padPrimal));
+    nProtect += 1;
+
+    PROTECT(R_fcall = lang4(rudata->Funcalc_func, rudata->sModel, rudata->FData, spadPrimal));
+    nProtect += 1;
+
+    PROTECT(spadF = coerceVector(eval(R_fcall, R_GlobalEnv), REALSXP));
+    nProtect += 1;
+
+    if(Rf_length(spadF) != nRows)
+    {
+        UNPROTECT(nProtect);
+        return LSERR_ERROR_IN_INPUT;
+    }
+
+    e = pCache->iNext;
+    pCache->iNext = (pCache->iNext + 1) % pCache->nEntries;
+    pCache->pbValid[e] = 1;
+    pCache->pnHash[e] = nHash;
+    memcpy(pCache->padX + (size_t)e * nVars, padPrimal, nVars * sizeof(double));
+    memcpy(pCache->padF + (size_t)e * nRows, NUMERIC_POINTER(spadF), nRows * sizeof(double));
+
+    *pdFuncVal = pCache->padF[(size_t)e * nRows + nRow + 1];
+
+    UNPROTECT(nProtect);
+    return 0;
+} /*relayFuncalcBatch*/
+
+/* Loads the triplets returned by the R gradient function into the row-wise
+   gradient cache, returns an error code */
+static int rLoadGradCache(rLindoGradCache_t *pCache,
+                          SEXP              sGrad)
+{
+    int    k, r, nNonz, nRows = pCache->nRows;
+    int    errorcode = 0;
+    int    *paiRow, *paiVar;
+    double *padVal;
+    SEXP   spaiRow, spaiVar, spadVal;
+
+    if(!isNewList(sGrad) || Rf_length(sGrad) < 3)
+    {
+        return LSERR_ERROR_IN_INPUT;
+    }
+
+    PROTECT(spaiRow = coerceVector(VECTOR_ELT(sGrad, 0), INTSXP));
+    PROTECT(spaiVar = coerceVector(VECTOR_ELT(sGrad, 1), INTSXP));
+    PROTECT(spadVal = coerceVector(VECTOR_ELT(sGrad, 2), REALSXP));
+
+    nNonz = Rf_length(spaiRow);
+    if(Rf_length(spaiVar) != nNonz || Rf_length(spadVal) != nNonz)
+    {
+        errorcode = LSERR_ERROR_IN_INPUT;
+        goto ErrorReturn;
+    }
+
+    paiRow = INTEGER(spaiRow);
+    paiVar = INTEGER(spaiVar);
+    padVal = REAL(spadVal);
+
+    if(nNonz > pCache->nNonzCap)
+    {
+        int    *paiNew = (int*)realloc(pCache->paiVar, nNonz * sizeof(int));
+        double *padNew;
+
+        if(paiNew == NULL)
+        {
+            errorcode = LSERR_OUT_OF_MEMORY;
+            goto ErrorReturn;
+        }
+        pCache->paiVar = paiNew;
+
+        padNew = (double*)realloc(pCache->padVal, nNonz * sizeof(double));
+        if(padNew == NULL)
+        {
+            errorcode = LSERR_OUT_OF_MEMORY;
+            goto ErrorReturn;
+        }
+        pCache->padVal = padNew;
+        pCache->nNonzCap = nNonz;
+    }
+
+    /* counting sort by row, the objective (-1) goes to row slot 0 */
+    memset(pCache->paiRowBeg, 0, (nRows + 1) * sizeof(int));
+    for(k = 0; k < nNonz; k++)
+    {
+        if(paiRow[k] < -1 || paiRow[k] >= nRows - 1 ||
+           paiVar[k] < 0 || paiVar[k] >= pCache->nVars)
+        {
+            errorcode = LSERR_INDEX_OUT_OF_RANGE;
+            goto ErrorReturn;
+        }
+        pCache->paiRowBeg[paiRow[k] + 2]++;
+    }
+    for(r = 0; r < nRows; r++)
+    {
+        pCache->paiRowBeg[r + 1] += pCache->paiRowBeg[r];
+    }
+    for(k = 0; k < nNonz; k++)
+    {
+        int nPos = pCache->paiRowBeg[paiRow[k] + 1]++;
+
+        pCache->paiVar[nPos] = paiVar[k];
+        pCache->padVal[nPos] = padVal[k];
+    }
+    /* the fill loop advanced each row start to the next row's start */
+    for(r = nRows; r > 0; r--)
+    {
+        pCache->paiRowBeg[r] = pCache->paiRowBeg[r - 1];
+    }
+    pCache->paiRowBeg[0] = 0;
+
+ErrorReturn:
+    UNPROTECT(3);
+    return errorcode;
+}
+
+/*
+* @brief relayGradcalc
+* @remark Evaluates the R gradient function once per primal point for all
+*         rows and answers the partial derivatives requested for each row
+*         from the cached sparse gradients.
+*/
+int    LS_CALLTYPE relayGradcalc(pLSmodel pModel, void    *userdata,
+    int      nRow, double  *padPrimal,
+    double   *padLB, double  *padUB,
+    int      nNewPnt, int     nNPar,
+    int      *parlist, double  *partial)
+{
+    rLindoData_t      *rudata = (rLindoData_t*)userdata;
+    rLindoGradCache_t *pCache = rudata->pGradCache;
+    int               k, nBeg, nEnd, nVars = rudata->nVars;
+    int               errorcode = 0, nProtect = 0;
+    SEXP              spadPrimal, R_fcall, sGrad;
+
+    if(pCache == NULL)
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+
+    if(nNewPnt || !pCache->bValid ||
+       memcmp(pCache->padX, padPrimal, nVars * sizeof(double)) != 0)
+    {
+        pCache->bValid = FALSE;
+
+        PROTECT(spadPrimal = rPrimalVector(rudata, padPrimal));
+        nProtect += 1;
+
+        PROTECT(R_fcall = lang4(rudata->Grad_func, rudata->sModel, rudata->GData, spadPrimal));
+        nProtect += 1;
+
+        PROTECT(sGrad = eval(R_fcall, R_GlobalEnv));
+        nProtect += 1;
+
+        errorcode = rLoadGradCache(pCache, sGrad);
+        UNPROTECT(nProtect);
+        if(errorcode)
+        {
+            return errorcode;
+        }
+
+        memcpy(pCache->padX, padPrimal, nVars * sizeof(double));
+        pCache->bValid = TRUE;
+    }
+
+    if(nRow < -1 || nRow >= pCache->nRows - 1)
+    {
+        return LSERR_INDEX_OUT_OF_RANGE;
+    }
+
+    /* scatter the row, gather the requested partials, clear the row */
+    nBeg = pCache->paiRowBeg[nRow + 1];
+    nEnd = pCache->paiRowBeg[nRow + 2];
+    for(k = nBeg; k < nEnd; k++)
+    {
+        pCache->padWork[pCache->paiVar[k]] += pCache->padVal[k];
+    }
+    for(k = 0; k < nNPar; k++)
+    {
+        partial[k] = pCache->padWork[parlist[k]];
+    }
+    for(k = nBeg; k < nEnd; k++)
+    {
+        pCache->padWork[pCache->paiVar[k]] = 0.0;
+    }
+
+    return 0;
+} /*relayGradcalc*/
+
 /*
 * @brief LSsetFuncalc
 * @param[in,out] sModel
@@ -19944,7 +20996,7 @@ SEXP rcLSsetFuncalc(SEXP sModel, SEXP sFunc, SEXP sData)
     char      *Names[1] = { "ErrorCode" };
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     rLindoData_t *rudata = NULL;
 
     ZERO_BUF(20);
@@ -19953,27 +21005,29 @@ SEXP rcLSsetFuncalc(SEXP sModel, SEXP sFunc, SEXP sData)
 
     CHECK_MODEL_ERROR;
 
-    rudata = (rLindoData_t*)LSgetObjHandle(pModel, LS_PTR_MODEL, LS_REF_FDATA);
-    if (rudata) {
-        free(rudata);
-    }
+    rudata = prModel->pCbData;
+
     if (!isFunction(sFunc)) {
         if (isNull(sFunc)) {
             *pnErrorCode = errorcode = LSsetFuncalc(pModel, NULL, NULL);
+            rSetCbSlot(&rudata->Funcalc_func, R_NilValue);
+            rSetCbSlot(&rudata->FData, R_NilValue);
+            rFreeFunCache(rudata->pFunCache);
+            rudata->pFunCache = NULL;
         }
         else {
             error("rLindo Error: arg#2 is required to be a function");
         }
     }
     else {
-        rudata = malloc(sizeof(rLindoData_t));
-        memset(rudata, 0, sizeof(rLindoData_t));
-        if (sFunc) {
-            rudata->pModel = pModel;
-            rudata->sModel = sModel;
-            rudata->Funcalc_func = sFunc;
-            rudata->FData = sData;
-        }
+        rudata->pModel = pModel;
+        rudata->sModel = sModel;
+        rSetCbSlot(&rudata->Funcalc_func, sFunc);
+        rSetCbSlot(&rudata->FData, sData);
+        rFreeFunCache(rudata->pFunCache);
+        rudata->pFunCache = NULL;
+        LSgetInfo(pModel, LS_IINFO_NUM_VARS, &rudata->nVars);
+        LSgetInfo(pModel, LS_IINFO_NUM_CONS, &rudata->nCons);
         *pnErrorCode = errorcode = LSsetFuncalc(pModel, relayFuncalc, rudata);
     }
 
@@ -19984,7 +21038,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /*
@@ -20014,19 +21068,14 @@ int LS_CALLTYPE relayMIPCallback(pLSmodel pModel, void *userdata, double dObjval
     dvecptr[2] = NUMERIC_POINTER(sdObjval);  //nRow
     *dvecptr[2] = dObjval;
 
-    errorcode = LSgetInfo(rudata->pModel, LS_IINFO_NUM_VARS, &n);
-    if (errorcode) goto ErrorReturn;
-
-    PROTECT(spadPrimal = NEW_NUMERIC(n));
+    PROTECT(spadPrimal = rPrimalVector(rudata, padPrimal));
     nProtect += 1;
-    dvecptr[3] = NUMERIC_POINTER(spadPrimal);  //padPrimal
-    memcpy(dvecptr[3], padPrimal, n * sizeof(double));
 
     nProtect += 1;
     PROTECT(R_fcall = lang5(sFunc, rudata->sModel, sData, sdObjval, spadPrimal));
 
     errorcode = asInteger(eval(R_fcall, sData));
-ErrorReturn:
+
     UNPROTECT(nProtect);
     return errorcode;
 } /*relayMIPCallback*/
@@ -20051,7 +21100,7 @@ SEXP rcLSsetMIPCallback(SEXP sModel, SEXP sFunc, SEXP sData)
     char      *Names[1] = { "ErrorCode" };
     SEXP      ListNames = R_NilValue;
     int       nNumItems = 1;
-    int       nIdx, nProtect = 0;
+    int       nProtect = 0;
     rLindoData_t *rudata = NULL;
 
     ZERO_BUF(20);
@@ -20060,27 +21109,25 @@ SEXP rcLSsetMIPCallback(SEXP sModel, SEXP sFunc, SEXP sData)
 
     CHECK_MODEL_ERROR;
 
-    rudata = (rLindoData_t*)LSgetObjHandle(pModel, LS_PTR_MODEL, LS_REF_MIPDATA);
-    if (rudata) {
-        free(rudata);
-    }
+    rudata = prModel->pCbData;
+
     if (!isFunction(sFunc)) {
         if (isNull(sFunc)) {
             *pnErrorCode = errorcode = LSsetMIPCallback(pModel, NULL, NULL);
+            rSetCbSlot(&rudata->mipFunc, R_NilValue);
+            rSetCbSlot(&rudata->mipData, R_NilValue);
         }
         else {
             error("rLindo Error: arg#2 is required to be a function");
         }
     }
     else {
-        rudata = malloc(sizeof(rLindoData_t));
-        memset(rudata, 0, sizeof(rLindoData_t));
-        if (sFunc) {
-            rudata->pModel = pModel;
-            rudata->sModel = sModel;
-            rudata->mipFunc = sFunc;
-            rudata->mipData = sData;
-        }
+        rudata->pModel = pModel;
+        rudata->sModel = sModel;
+        rSetCbSlot(&rudata->mipFunc, sFunc);
+        rSetCbSlot(&rudata->mipData, sData);
+        LSgetInfo(pModel, LS_IINFO_NUM_VARS, &rudata->nVars);
+        LSgetInfo(pModel, LS_IINFO_NUM_CONS, &rudata->nCons);
         *pnErrorCode = errorcode = LSsetMIPCallback(pModel, relayMIPCallback, rudata);
     }
 
@@ -20091,7 +21138,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 0, spnErrorCode);
     UNPROTECT(nProtect + 2);
 
-    return rList;
+    return rReturnList(rList);
 }
 
 /*
@@ -20121,7 +21168,7 @@ SEXP rcLSgetObjPoolParam(SEXP spModel, SEXP snObjIndex, SEXP smParam)
   char      *Names[2] = { "ErrorCode","pdValue" };
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 2;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
   SEXP spdValue = R_NilValue;
 
@@ -20160,7 +21207,7 @@ ErrorReturn:
     SET_VECTOR_ELT(rList, 1, spdValue);
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -20190,7 +21237,7 @@ SEXP rcLSgetProgressInfo(SEXP spModel, SEXP snLocation, SEXP snQuery)
   char      *Names[1] = { "ErrorCode" };
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -20223,7 +21270,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -20253,7 +21300,7 @@ SEXP rcLSdeleteIndConstraints(SEXP spModel, SEXP snCons, SEXP spaiCons)
   char      *Names[1] = { "ErrorCode" };
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -20287,7 +21334,7 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
 
 }
 
@@ -20320,7 +21367,7 @@ SEXP rcLSloadIndData(SEXP spModel, SEXP snIndicRows, SEXP spaiIndicRows, SEXP sp
   char      *Names[1] = { "ErrorCode" };
   SEXP      ListNames = R_NilValue;
   int       nNumItems = 1;
-  int       nIdx, nProtect = 0;
+  int       nProtect = 0;
 
 
 
@@ -20362,6 +21409,4705 @@ ErrorReturn:
   if (!errorcode) {
   }
   UNPROTECT(nProtect + 2);
-  return rList;
+  return rReturnList(rList);
+
+}
+
+/********************************************************
+* rLindo Extensions                                     *
+*********************************************************/
+
+/*
+* @brief rcLSsetRawMode
+* @param[in] sbRaw  TRUE to return payloads directly, FALSE for named lists
+* @return logical The previous mode
+* @remark In raw mode a wrapper with a single payload returns that payload,
+*         a wrapper with no payload returns NULL, and a nonzero error code
+*         is raised as an R error instead of being returned.
+*/
+SEXP rcLSsetRawMode(SEXP sbRaw)
+{
+    int bPrevMode = rLindoRawMode;
+
+    rLindoRawMode = Rf_asLogical(sbRaw) == TRUE;
+
+    return ScalarLogical(bPrevMode);
+}
+
+/*
+* @brief rcLSsetCallbackInterval
+* @param[in] sModel
+* @param[in] snMsec  Minimum time between two R_ProcessEvents calls of the
+*                    default callback, 0 for every call, <0 to remove it
+* @return int An integer error code
+* @remark A callback installed with rLSsetCallback is left in place, the
+*         interval applies once it is removed.
+*/
+SEXP rcLSsetCallbackInterval(SEXP sModel, SEXP snMsec)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nMsec = Rf_asInteger(snMsec);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    prModel->nCbIntervalMs = nMsec;
+    prModel->dLastEventsMs = 0;
+
+    if(prModel->pCbData->cbFunc == NULL)
+    {
+        if(nMsec < 0)
+        {
+            *pnErrorCode = LSsetCallback(pModel, NULL, NULL);
+        }
+        else
+        {
+            *pnErrorCode = LSsetCallback(pModel, (cbFunc_t)rCallBack, prModel);
+        }
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSsetDefaultCallbackInterval
+* @param[in] snMsec  Default interval for models created afterwards, <0 to
+*                    create models without the default callback
+* @return int The previous default
+*/
+SEXP rcLSsetDefaultCallbackInterval(SEXP snMsec)
+{
+    int nPrevMsec = rLindoCbIntervalMs;
+
+    rLindoCbIntervalMs = Rf_asInteger(snMsec);
+
+    return ScalarInteger(nPrevMsec);
+}
+
+/* Reinstalls the log function the model's settings call for */
+static int rRestoreModelLog(prLSmodel prModel)
+{
+    pLSmodel pModel = prModel->pModel;
+
+    if(prModel->bLogOff)
+    {
+        return LSsetModelLogfunc(pModel, NULL, NULL);
+    }
+    else if(prModel->pLogBuf != NULL)
+    {
+        return LSsetModelLogfunc(pModel, rBufferLog, prModel);
+    }
+    else if(prModel->pCbData->locFunc != NULL)
+    {
+        return LSsetModelLogfunc(pModel, relayLogfunc, prModel->pCbData);
+    }
+    else
+    {
+        return LSsetModelLogfunc(pModel, (printLOG_t)rPrintLog, NULL);
+    }
+}
+
+/*
+* @brief rcLSsetLogBuffer
+* @param[in] sModel
+* @param[in] snCapacity    Number of recent lines retained, 0 to disable buffering
+* @param[in] snBatch       Deliver pending lines once this many have accumulated
+* @param[in] snIntervalMs  Deliver pending lines once this much time has passed
+* @return int An integer error code
+* @remark Pending lines are also delivered when rLSoptimize, rLSsolveMIP and
+*         rLSsolveGOP return. A log closure set with rLSsetModelLogfunc
+*         receives each batch as a character vector.
+*/
+SEXP rcLSsetLogBuffer(SEXP sModel, SEXP snCapacity, SEXP snBatch, SEXP snIntervalMs)
+{
+    prLSmodel prModel;
+    int       nCapacity = Rf_asInteger(snCapacity);
+    rLindoLogBuf_t *pLogBuf;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_HANDLE;
+
+    rFlushLogBuf(prModel);
+    rFreeLogBuf(prModel->pLogBuf);
+    prModel->pLogBuf = NULL;
+
+    if(nCapacity <= 0 || nCapacity == NA_INTEGER)
+    {
+        *pnErrorCode = rRestoreModelLog(prModel);
+        goto ErrorReturn;
+    }
+
+    pLogBuf = (rLindoLogBuf_t*)calloc(1, sizeof(rLindoLogBuf_t));
+    if(pLogBuf == NULL ||
+       (pLogBuf->paszLines = (char**)calloc(nCapacity, sizeof(char*))) == NULL)
+    {
+        free(pLogBuf);
+        *pnErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
+    }
+    pLogBuf->nCapacity = nCapacity;
+    pLogBuf->nBatch = Rf_asInteger(snBatch) > 0 ? Rf_asInteger(snBatch) : 0;
+    pLogBuf->nIntervalMs = Rf_asInteger(snIntervalMs) > 0 ? Rf_asInteger(snIntervalMs) : 0;
+    pLogBuf->dLastFlushMs = rMonotonicMs();
+    prModel->pLogBuf = pLogBuf;
+
+    *pnErrorCode = rRestoreModelLog(prModel);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSgetLogBuffer
+* @param[in] sModel
+* @return int An integer error code
+* @remark ErrorCode,paszLines = rLSgetLogBuffer(model), the retained lines
+*         oldest first, whether or not they have been delivered
+*/
+SEXP rcLSgetLogBuffer(SEXP sModel)
+{
+    prLSmodel prModel;
+    rLindoLogBuf_t *pLogBuf;
+    int       k;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spaszLines = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode","paszLines"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_HANDLE;
+
+    pLogBuf = prModel->pLogBuf;
+    PROTECT(spaszLines = NEW_CHARACTER(pLogBuf ? pLogBuf->nCount : 0));
+    nProtect += 1;
+    for(k = 0; pLogBuf && k < pLogBuf->nCount; k++)
+        SET_STRING_ELT(spaszLines, k,
+            mkChar(pLogBuf->paszLines[(pLogBuf->nHead + k) % pLogBuf->nCapacity]));
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    if(*pnErrorCode == LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 1, spaszLines);
+    }
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSsetFuncalcBatch
+* @param[in] sModel
+* @param[in] sFunc   function(model, data, padPrimal) returning the values of
+*                    the objective and of every constraint at padPrimal
+* @param[in] sData
+* @param[in] snCache number of primal points whose values are kept
+* @return int An integer error code
+* @remark Replaces a function set with rLSsetFuncalc and vice versa.
+*/
+SEXP rcLSsetFuncalcBatch(SEXP sModel, SEXP sFunc, SEXP sData, SEXP snCache)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nCache = Rf_asInteger(snCache);
+    rLindoData_t *rudata = NULL;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    rudata = prModel->pCbData;
+
+    if (!isFunction(sFunc) && !isNull(sFunc)) {
+        error("rLindo Error: arg#2 is required to be a function");
+    }
+
+    rFreeFunCache(rudata->pFunCache);
+    rudata->pFunCache = NULL;
+
+    if (isNull(sFunc)) {
+        *pnErrorCode = LSsetFuncalc(pModel, NULL, NULL);
+        rSetCbSlot(&rudata->Funcalc_func, R_NilValue);
+        rSetCbSlot(&rudata->FData, R_NilValue);
+        goto ErrorReturn;
+    }
+
+    if (nCache < 1 || nCache == NA_INTEGER) {
+        nCache = 1;
+    }
+
+    LSgetInfo(pModel, LS_IINFO_NUM_VARS, &rudata->nVars);
+    LSgetInfo(pModel, LS_IINFO_NUM_CONS, &rudata->nCons);
+    rudata->pFunCache = rNewFunCache(nCache, rudata->nVars, rudata->nCons);
+    if (rudata->pFunCache == NULL) {
+        *pnErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
+    }
+
+    rudata->pModel = pModel;
+    rudata->sModel = sModel;
+    rSetCbSlot(&rudata->Funcalc_func, sFunc);
+    rSetCbSlot(&rudata->FData, sData);
+    *pnErrorCode = LSsetFuncalc(pModel, relayFuncalcBatch, rudata);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSsetCallbackPrimalReuse
+* @param[in] sModel
+* @param[in] sbReuse  TRUE to pass the primal point to the funcalc and MIP
+*                     callbacks in one vector that is refilled on every call
+* @return int An integer error code
+*/
+SEXP rcLSsetCallbackPrimalReuse(SEXP sModel, SEXP sbReuse)
+{
+    prLSmodel prModel;
+    rLindoData_t *rudata = NULL;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_HANDLE;
+
+    rudata = prModel->pCbData;
+    rudata->bReusePrimal = Rf_asLogical(sbReuse) == TRUE;
+    if(!rudata->bReusePrimal)
+    {
+        rSetCbSlot(&rudata->sPrimalBuf, R_NilValue);
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSsetGradcalc
+* @param[in] sModel
+* @param[in] sFunc      function(model, data, padPrimal) returning the
+*                       nonzero partial derivatives of all rows as a list
+*                       (paiRows, paiVars, padVals), row -1 being the objective
+* @param[in] sData
+* @param[in] spnUseGrad rows whose gradients sFunc supplies, NULL for all
+* @return int An integer error code
+*/
+SEXP rcLSsetGradcalc(SEXP sModel, SEXP sFunc, SEXP sData, SEXP spnUseGrad)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    rLindoData_t *rudata = NULL;
+    int       nLenUseGrad = 0;
+    int       *pnUseGrad = NULL;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    rudata = prModel->pCbData;
+
+    if (!isFunction(sFunc) && !isNull(sFunc)) {
+        error("rLindo Error: arg#2 is required to be a function");
+    }
+
+    rFreeGradCache(rudata->pGradCache);
+    rudata->pGradCache = NULL;
+
+    if (isNull(sFunc)) {
+        *pnErrorCode = LSsetGradcalc(pModel, NULL, NULL, 0, NULL);
+        rSetCbSlot(&rudata->Grad_func, R_NilValue);
+        rSetCbSlot(&rudata->GData, R_NilValue);
+        goto ErrorReturn;
+    }
+
+    if (!isNull(spnUseGrad)) {
+        nLenUseGrad = Rf_length(spnUseGrad);
+        pnUseGrad = INTEGER(spnUseGrad);
+    }
+
+    LSgetInfo(pModel, LS_IINFO_NUM_VARS, &rudata->nVars);
+    LSgetInfo(pModel, LS_IINFO_NUM_CONS, &rudata->nCons);
+    rudata->pGradCache = rNewGradCache(rudata->nVars, rudata->nCons);
+    if (rudata->pGradCache == NULL) {
+        *pnErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
+    }
+
+    rudata->pModel = pModel;
+    rudata->sModel = sModel;
+    rSetCbSlot(&rudata->Grad_func, sFunc);
+    rSetCbSlot(&rudata->GData, sData);
+    *pnErrorCode = LSsetGradcalc(pModel, relayGradcalc, rudata, nLenUseGrad, pnUseGrad);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/* Resolves a native routine given as an external pointer, e.g. the address
+   of a NativeSymbolInfo of a routine the package did not register, or as
+   c(package, name) registered by the package with R_RegisterCCallable.
+   The address of a registered routine points to R's registration record
+   rather than to the routine and is rejected. */
+static DL_FUNC rNativeRoutine(SEXP sRoutine, const char *szArg)
+{
+    if(isNull(sRoutine))
+    {
+        return NULL;
+    }
+
+    if(TYPEOF(sRoutine) == EXTPTRSXP)
+    {
+        DL_FUNC pRoutine;
+
+        if(R_ExternalPtrTag(sRoutine) == install("registered native symbol"))
+        {
+            error("rLindo Error: %s is a registered routine, pass c(package, name) "
+                  "for a routine exported with R_RegisterCCallable instead", szArg);
+        }
+        pRoutine = (DL_FUNC)R_ExternalPtrAddrFn(sRoutine);
+
+        if(pRoutine == NULL)
+        {
+            error("rLindo Error: %s is a null pointer", szArg);
+        }
+        return pRoutine;
+    }
+
+    if(isString(sRoutine) && Rf_length(sRoutine) == 2)
+    {
+        /* R_GetCCallable raises an R error if the routine is not found */
+        return R_GetCCallable(CHAR(STRING_ELT(sRoutine, 0)),
+                              CHAR(STRING_ELT(sRoutine, 1)));
+    }
+
+    error("rLindo Error: %s is required to be an external pointer or c(package, name)", szArg);
+    return NULL;
+}
+
+/*
+* @brief rcLSsetNativeFuncalc
+* @param[in] sModel
+* @param[in] sFuncalc   native Funcalc_type routine, or NULL
+* @param[in] sGradcalc  native Gradcalc_type routine, or NULL
+* @param[in] sData      external pointer passed as user data to both routines
+* @param[in] spnUseGrad rows whose gradients sGradcalc supplies, NULL for all
+* @return int An integer error code
+* @remark The routines are registered with LINDO API directly and are called
+*         without entering R. Replaces functions set with rLSsetFuncalc,
+*         rLSsetFuncalcBatch and rLSsetGradcalc.
+*/
+SEXP rcLSsetNativeFuncalc(SEXP sModel, SEXP sFuncalc, SEXP sGradcalc, SEXP sData, SEXP spnUseGrad)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    rLindoData_t *rudata = NULL;
+    Funcalc_type  pfFuncalc;
+    Gradcalc_type pfGradcalc;
+    void      *pUserData = NULL;
+    int       nLenUseGrad = 0;
+    int       *pnUseGrad = NULL;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    rudata = prModel->pCbData;
+
+    pfFuncalc = (Funcalc_type)rNativeRoutine(sFuncalc, "arg#2");
+    pfGradcalc = (Gradcalc_type)rNativeRoutine(sGradcalc, "arg#3");
+
+    if (TYPEOF(sData) == EXTPTRSXP) {
+        pUserData = R_ExternalPtrAddr(sData);
+    }
+    else if (!isNull(sData)) {
+        error("rLindo Error: arg#4 is required to be an external pointer");
+    }
+
+    if (!isNull(spnUseGrad)) {
+        nLenUseGrad = Rf_length(spnUseGrad);
+        pnUseGrad = INTEGER(spnUseGrad);
+    }
+
+    /* drop any R level functions, the data pointer is kept alive instead */
+    rFreeFunCache(rudata->pFunCache);
+    rudata->pFunCache = NULL;
+    rFreeGradCache(rudata->pGradCache);
+    rudata->pGradCache = NULL;
+    rSetCbSlot(&rudata->Funcalc_func, R_NilValue);
+    rSetCbSlot(&rudata->Grad_func, R_NilValue);
+    rSetCbSlot(&rudata->GData, R_NilValue);
+    rSetCbSlot(&rudata->FData, sData);
+
+    *pnErrorCode = LSsetFuncalc(pModel, pfFuncalc, pfFuncalc ? pUserData : NULL);
+    if (*pnErrorCode) goto ErrorReturn;
+
+    if (pfGradcalc) {
+        *pnErrorCode = LSsetGradcalc(pModel, pfGradcalc, pUserData, nLenUseGrad, pnUseGrad);
+    }
+    else {
+        *pnErrorCode = LSsetGradcalc(pModel, NULL, NULL, 0, NULL);
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+#define rLS_NAMES_VAR  0
+#define rLS_NAMES_CON  1
+#define rLS_NAMES_CONE 2
+
+/* Fills a character vector with the names of variables, constraints or cones
+   iBeg..iEnd (inclusive, iEnd < 0 meaning the last one) in one pass */
+static SEXP rGetNameRange(SEXP sModel,
+                          int  nKind,
+                          SEXP siBeg,
+                          SEXP siEnd)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       iBeg = Rf_asInteger(siBeg);
+    int       iEnd = Rf_asInteger(siEnd);
+    int       nCount = 0, nItems, k;
+    char      achName[256];
+    static const int anInfo[3] = {LS_IINFO_NUM_VARS, LS_IINFO_NUM_CONS, LS_IINFO_NUM_CONES};
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spaszNames = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "paszNames"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    *pnErrorCode = LSgetInfo(pModel, anInfo[nKind], &nCount);
+    CHECK_ERRCODE;
+
+    if(iEnd < 0 || iEnd == NA_INTEGER)
+    {
+        iEnd = nCount - 1;
+    }
+    if(iBeg == NA_INTEGER || iBeg < 0 || iEnd >= nCount || iBeg > iEnd + 1)
+    {
+        *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+        goto ErrorReturn;
+    }
+
+    nItems = iEnd - iBeg + 1;
+    PROTECT(spaszNames = NEW_CHARACTER(nItems));
+    nProtect += 1;
+
+    for(k = 0; k < nItems; k++)
+    {
+        if(nKind == rLS_NAMES_VAR)
+        {
+            *pnErrorCode = LSgetVariableNamej(pModel, iBeg + k, achName);
+        }
+        else if(nKind == rLS_NAMES_CON)
+        {
+            *pnErrorCode = LSgetConstraintNamei(pModel, iBeg + k, achName);
+        }
+        else
+        {
+            *pnErrorCode = LSgetConeNamei(pModel, iBeg + k, achName);
+        }
+        CHECK_ERRCODE;
+
+        /* mkChar returns the cached CHARSXP when the name is already interned */
+        SET_STRING_ELT(spaszNames, k, mkChar(achName));
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spaszNames);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSgetVariableNames
+* @param[in] sModel
+* @param[in] siBeg   index of the first variable
+* @param[in] siEnd   index of the last variable, -1 for the last one
+* @return int An integer error code
+* @remark ErrorCode,paszNames = rLSgetVariableNames(model,iBeg,iEnd)
+*/
+SEXP rcLSgetVariableNames(SEXP sModel, SEXP siBeg, SEXP siEnd)
+{
+    return rGetNameRange(sModel, rLS_NAMES_VAR, siBeg, siEnd);
+}
+
+/*
+* @brief rcLSgetConstraintNames
+* @param[in] sModel
+* @param[in] siBeg   index of the first constraint
+* @param[in] siEnd   index of the last constraint, -1 for the last one
+* @return int An integer error code
+* @remark ErrorCode,paszNames = rLSgetConstraintNames(model,iBeg,iEnd)
+*/
+SEXP rcLSgetConstraintNames(SEXP sModel, SEXP siBeg, SEXP siEnd)
+{
+    return rGetNameRange(sModel, rLS_NAMES_CON, siBeg, siEnd);
+}
+
+/*
+* @brief rcLSgetConeNames
+* @param[in] sModel
+* @param[in] siBeg   index of the first cone
+* @param[in] siEnd   index of the last cone, -1 for the last one
+* @return int An integer error code
+* @remark ErrorCode,paszNames = rLSgetConeNames(model,iBeg,iEnd)
+*/
+SEXP rcLSgetConeNames(SEXP sModel, SEXP siBeg, SEXP siEnd)
+{
+    return rGetNameRange(sModel, rLS_NAMES_CONE, siBeg, siEnd);
+}
+
+static unsigned int rHashName(const char *pszName)
+{
+    unsigned int nHash = 2166136261U;
+
+    while(*pszName)
+    {
+        nHash ^= (unsigned char)*pszName++;
+        nHash *= 16777619U;
+    }
+
+    return nHash;
+}
+
+/* Reads all variable (bCons = 0) or constraint names of a model into a new
+   hash index, returns NULL and sets *pnErrorCode on failure */
+static rLindoNameIndex_t *rBuildNameIndex(pLSmodel pModel,
+                                          int      bCons,
+                                          int      *pnErrorCode)
+{
+    rLindoNameIndex_t *pIndex = NULL;
+    int               k, nNames = 0, nLen, nUsed = 0, nCap;
+    unsigned int      nSlot;
+    char              achName[256];
+
+    *pnErrorCode = LSgetInfo(pModel, bCons ? LS_IINFO_NUM_CONS : LS_IINFO_NUM_VARS, &nNames);
+    if(*pnErrorCode)
+    {
+        return NULL;
+    }
+
+    pIndex = (rLindoNameIndex_t*)calloc(1, sizeof(rLindoNameIndex_t));
+    if(pIndex == NULL)
+    {
+        goto ErrorReturn;
+    }
+
+    pIndex->nNames = nNames;
+    for(pIndex->nSlots = 16; pIndex->nSlots < 2 * nNames; pIndex->nSlots *= 2);
+    pIndex->paiSlot = (int*)malloc(pIndex->nSlots * sizeof(int));
+    pIndex->paiOffset = (int*)malloc((nNames > 0 ? nNames : 1) * sizeof(int));
+    nCap = 16 * (nNames > 0 ? nNames : 1);
+    pIndex->pachArena = (char*)malloc(nCap);
+    if(!pIndex->paiSlot || !pIndex->paiOffset || !pIndex->pachArena)
+    {
+        goto ErrorReturn;
+    }
+    memset(pIndex->paiSlot, -1, pIndex->nSlots * sizeof(int));
+
+    for(k = 0; k < nNames; k++)
+    {
+        if(bCons)
+        {
+            *pnErrorCode = LSgetConstraintNamei(pModel, k, achName);
+        }
+        else
+        {
+            *pnErrorCode = LSgetVariableNamej(pModel, k, achName);
+        }
+        if(*pnErrorCode)
+        {
+            rFreeNameIndex(pIndex);
+            return NULL;
+        }
+
+        nLen = (int)strlen(achName) + 1;
+        if(nUsed + nLen > nCap)
+        {
+            char *pachNew;
+
+            nCap = 2 * nCap + nLen;
+            pachNew = (char*)realloc(pIndex->pachArena, nCap);
+            if(pachNew == NULL)
+            {
+                goto ErrorReturn;
+            }
+            pIndex->pachArena = pachNew;
+        }
+        memcpy(pIndex->pachArena + nUsed, achName, nLen);
+        pIndex->paiOffset[k] = nUsed;
+        nUsed += nLen;
+
+        /* keep the first of duplicate names, as a linear search would */
+        nSlot = rHashName(achName) & (pIndex->nSlots - 1);
+        while(pIndex->paiSlot[nSlot] >= 0 &&
+              strcmp(pIndex->pachArena + pIndex->paiOffset[pIndex->paiSlot[nSlot]], achName) != 0)
+        {
+            nSlot = (nSlot + 1) & (pIndex->nSlots - 1);
+        }
+        if(pIndex->paiSlot[nSlot] < 0)
+        {
+            pIndex->paiSlot[nSlot] = k;
+        }
+    }
+
+    return pIndex;
+
+ErrorReturn:
+    rFreeNameIndex(pIndex);
+    *pnErrorCode = LSERR_OUT_OF_MEMORY;
+    return NULL;
+}
+
+static int rLookupName(rLindoNameIndex_t *pIndex,
+                       const char        *pszName)
+{
+    unsigned int nSlot = rHashName(pszName) & (pIndex->nSlots - 1);
+
+    while(pIndex->paiSlot[nSlot] >= 0)
+    {
+        if(strcmp(pIndex->pachArena + pIndex->paiOffset[pIndex->paiSlot[nSlot]], pszName) == 0)
+        {
+            return pIndex->paiSlot[nSlot];
+        }
+        nSlot = (nSlot + 1) & (pIndex->nSlots - 1);
+    }
+
+    return -1;
+}
+
+static SEXP rGetNameIndices(SEXP sModel,
+                            int  bCons,
+                            SEXP spaszNames)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    rLindoNameIndex_t **ppIndex;
+    int       k, nItems, *paiIndex;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spaiIndex = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "paiIndex"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    if(!isString(spaszNames))
+    {
+        error("rLindo Error: arg#2 is required to be a character vector");
+    }
+
+    ppIndex = bCons ? &prModel->pConIndex : &prModel->pVarIndex;
+    if(*ppIndex == NULL)
+    {
+        *ppIndex = rBuildNameIndex(pModel, bCons, pnErrorCode);
+        CHECK_ERRCODE;
+    }
+
+    nItems = Rf_length(spaszNames);
+    PROTECT(spaiIndex = NEW_INTEGER(nItems));
+    nProtect += 1;
+    paiIndex = INTEGER_POINTER(spaiIndex);
+
+    for(k = 0; k < nItems; k++)
+    {
+        SEXP sName = STRING_ELT(spaszNames, k);
+
+        paiIndex[k] = sName == NA_STRING ? -1 : rLookupName(*ppIndex, CHAR(sName));
+        if(paiIndex[k] < 0)
+        {
+            paiIndex[k] = NA_INTEGER;
+        }
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spaiIndex);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSgetVariableIndices
+* @param[in] sModel
+* @param[in] spaszVarNames  character vector of variable names
+* @return int An integer error code
+* @remark ErrorCode,paiIndex = rLSgetVariableIndices(model,paszVarNames)
+*/
+SEXP rcLSgetVariableIndices(SEXP sModel, SEXP spaszVarNames)
+{
+    return rGetNameIndices(sModel, FALSE, spaszVarNames);
+}
+
+/*
+* @brief rcLSgetConstraintIndices
+* @param[in] sModel
+* @param[in] spaszConNames  character vector of constraint names
+* @return int An integer error code
+* @remark ErrorCode,paiIndex = rLSgetConstraintIndices(model,paszConNames)
+*/
+SEXP rcLSgetConstraintIndices(SEXP sModel, SEXP spaszConNames)
+{
+    return rGetNameIndices(sModel, TRUE, spaszConNames);
+}
+
+/* Returns the element of a list or data.frame with the given name, or
+   R_NilValue */
+static SEXP rListElt(SEXP sList, const char *szName)
+{
+    SEXP sNames = getAttrib(sList, R_NamesSymbol);
+    int  k;
+
+    for(k = 0; k < Rf_length(sNames); k++)
+    {
+        if(strcmp(CHAR(STRING_ELT(sNames, k)), szName) == 0)
+        {
+            return VECTOR_ELT(sList, k);
+        }
+    }
+
+    return R_NilValue;
+}
+
+/*
+* @brief rcLSloadLPSparse
+* @param[in] sModel
+* @param[in] snObjSense
+* @param[in] sdObjConst
+* @param[in] spadC        objective coefficients, its length gives nVars
+* @param[in] spadB        right-hand sides, its length gives nCons
+* @param[in] spszConTypes
+* @param[in] sA           constraint matrix: a dgCMatrix or dgTMatrix, a
+*                         list or data.frame of triplets (i, j, x), or a
+*                         dense numeric matrix
+* @param[in] spadL
+* @param[in] spadU
+* @param[in] snIndexBase  index base of the i and j columns of a triplet list
+* @return int An integer error code
+* @remark The slots of a dgCMatrix are passed to LSloadLPData as they are.
+*         Other forms are converted to column-major form in one pass, summing
+*         duplicate triplets.
+*/
+SEXP rcLSloadLPSparse(SEXP      sModel,
+                      SEXP      snObjSense,
+                      SEXP      sdObjConst,
+                      SEXP      spadC,
+                      SEXP      spadB,
+                      SEXP      spszConTypes,
+                      SEXP      sA,
+                      SEXP      spadL,
+                      SEXP      spadU,
+                      SEXP      snIndexBase)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+
+    int       nCons = Rf_length(spadB);
+    int       nVars = Rf_length(spadC);
+    int       nObjSense = Rf_asInteger(snObjSense);
+    double    dObjConst = Rf_asReal(sdObjConst);
+    int       nIndexBase = Rf_asInteger(snIndexBase);
+    double    *padC = REAL(spadC);
+    double    *padB = REAL(spadB);
+    char      *pszConTypes;
+    double    *padL;
+    double    *padU;
+    int       nAnnz = 0, nPos, k, r, j;
+    int       *paiAcols = NULL, *paiArows = NULL;
+    double    *padAcoef = NULL;
+    int       *paiI = NULL, *paiJ = NULL, *paiPos;
+    double    *padX = NULL;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    MAKE_REAL_ARRAY(padL,spadL);
+    MAKE_REAL_ARRAY(padU,spadU);
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    if(!isString(spszConTypes) || Rf_length(spszConTypes) != 1 ||
+       (int)strlen(CHAR(STRING_ELT(spszConTypes,0))) != nCons)
+    {
+        error("rLindo Error: pszConTypes must have one character per constraint");
+    }
+    pszConTypes = (char *) CHAR(STRING_ELT(spszConTypes,0));
+    if((padL && Rf_length(spadL) != nVars) || (padU && Rf_length(spadU) != nVars))
+    {
+        error("rLindo Error: padL and padU must have one element per variable");
+    }
+
+    if(inherits(sA, "dgCMatrix") || inherits(sA, "dgTMatrix"))
+    {
+        int *panDim = INTEGER(GET_SLOT(sA, install("Dim")));
+
+        if(panDim[0] != nCons || panDim[1] != nVars)
+        {
+            error("rLindo Error: the matrix is %d x %d, the model is %d x %d",
+                  panDim[0], panDim[1], nCons, nVars);
+        }
+    }
+
+    if(inherits(sA, "dgCMatrix"))
+    {
+        SEXP spanP = GET_SLOT(sA, install("p"));
+
+        if(Rf_length(spanP) != nVars + 1)
+        {
+            error("rLindo Error: the dgCMatrix is malformed");
+        }
+
+        paiAcols = INTEGER(spanP);
+        paiArows = INTEGER(GET_SLOT(sA, install("i")));
+        padAcoef = REAL(GET_SLOT(sA, install("x")));
+        nAnnz = paiAcols[nVars];
+
+        if(paiAcols[0] != 0 ||
+           Rf_length(GET_SLOT(sA, install("i"))) < nAnnz ||
+           Rf_length(GET_SLOT(sA, install("x"))) < nAnnz)
+        {
+            error("rLindo Error: the dgCMatrix is malformed");
+        }
+        for(j = 0; j < nVars; j++)
+        {
+            if(paiAcols[j + 1] < paiAcols[j])
+            {
+                error("rLindo Error: the dgCMatrix is malformed");
+            }
+        }
+        for(k = 0; k < nAnnz; k++)
+        {
+            if(paiArows[k] < 0 || paiArows[k] >= nCons)
+            {
+                *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+                goto ErrorReturn;
+            }
+        }
+    }
+    else if(isMatrix(sA) && (isReal(sA) || isInteger(sA)))
+    {
+        SEXP sDense;
+
+        if(Rf_nrows(sA) != nCons || Rf_ncols(sA) != nVars)
+        {
+            error("rLindo Error: the matrix is %d x %d, the model is %d x %d",
+                  Rf_nrows(sA), Rf_ncols(sA), nCons, nVars);
+        }
+        PROTECT(sDense = coerceVector(sA, REALSXP));
+        nProtect += 1;
+        padX = REAL(sDense);
+
+        for(j = 0; j < nVars; j++)
+        {
+            for(r = 0; r < nCons; r++)
+            {
+                if(padX[(size_t)j * nCons + r] != 0.0) nAnnz++;
+            }
+        }
+
+        paiAcols = (int*)R_alloc(nVars + 1, sizeof(int));
+        paiArows = (int*)R_alloc(nAnnz > 0 ? nAnnz : 1, sizeof(int));
+        padAcoef = (double*)R_alloc(nAnnz > 0 ? nAnnz : 1, sizeof(double));
+        nAnnz = 0;
+        for(j = 0; j < nVars; j++)
+        {
+            paiAcols[j] = nAnnz;
+            for(r = 0; r < nCons; r++)
+            {
+                double dVal = padX[(size_t)j * nCons + r];
+
+                if(dVal != 0.0)
+                {
+                    paiArows[nAnnz] = r;
+                    padAcoef[nAnnz] = dVal;
+                    nAnnz++;
+                }
+            }
+        }
+        paiAcols[nVars] = nAnnz;
+    }
+    else if(inherits(sA, "dgTMatrix") || isNewList(sA))
+    {
+        SEXP spaiI, spaiJ, spadX;
+        int  nBase = 0;
+
+        if(inherits(sA, "dgTMatrix"))
+        {
+            spaiI = GET_SLOT(sA, install("i"));
+            spaiJ = GET_SLOT(sA, install("j"));
+            spadX = GET_SLOT(sA, install("x"));
+        }
+        else
+        {
+            nBase = nIndexBase == NA_INTEGER ? 0 : nIndexBase;
+            spaiI = rListElt(sA, "i");
+            spaiJ = rListElt(sA, "j");
+            spadX = rListElt(sA, "x");
+            if(isNull(spaiI) || isNull(spaiJ) || isNull(spadX))
+            {
+                error("rLindo Error: the triplet list needs columns i, j and x");
+            }
+        }
+
+        /* coerceVector returns its argument when no conversion is needed */
+        PROTECT(spaiI = coerceVector(spaiI, INTSXP));
+        PROTECT(spaiJ = coerceVector(spaiJ, INTSXP));
+        PROTECT(spadX = coerceVector(spadX, REALSXP));
+        nProtect += 3;
+        paiI = INTEGER(spaiI);
+        paiJ = INTEGER(spaiJ);
+        padX = REAL(spadX);
+        nAnnz = Rf_length(spadX);
+        if(Rf_length(spaiI) != nAnnz || Rf_length(spaiJ) != nAnnz)
+        {
+            error("rLindo Error: i, j and x must have the same length");
+        }
+
+        /* counting sort of the triplets by column */
+        paiAcols = (int*)R_alloc(nVars + 1, sizeof(int));
+        paiArows = (int*)R_alloc(nAnnz > 0 ? nAnnz : 1, sizeof(int));
+        padAcoef = (double*)R_alloc(nAnnz > 0 ? nAnnz : 1, sizeof(double));
+        memset(paiAcols, 0, (nVars + 1) * sizeof(int));
+        for(k = 0; k < nAnnz; k++)
+        {
+            r = paiI[k] - nBase;
+            j = paiJ[k] - nBase;
+            if(paiI[k] == NA_INTEGER || paiJ[k] == NA_INTEGER ||
+               r < 0 || r >= nCons || j < 0 || j >= nVars)
+            {
+                *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+                goto ErrorReturn;
+            }
+            paiAcols[j + 1]++;
+        }
+        for(j = 0; j < nVars; j++)
+        {
+            paiAcols[j + 1] += paiAcols[j];
+        }
+        for(k = 0; k < nAnnz; k++)
+        {
+            int nPos = paiAcols[paiJ[k] - nBase]++;
+
+            paiArows[nPos] = paiI[k] - nBase;
+            padAcoef[nPos] = padX[k];
+        }
+        for(j = nVars; j > 0; j--)
+        {
+            paiAcols[j] = paiAcols[j - 1];
+        }
+        paiAcols[0] = 0;
+
+        /* sum duplicate (i, j) entries in place, as the Matrix package does;
+           paiPos[r] is where row r went in the column being compacted */
+        paiPos = (int*)R_alloc(nCons > 0 ? nCons : 1, sizeof(int));
+        for(r = 0; r < nCons; r++)
+        {
+            paiPos[r] = -1;
+        }
+        nPos = 0;
+        for(j = 0; j < nVars; j++)
+        {
+            int nColBeg = nPos;
+
+            for(k = paiAcols[j]; k < paiAcols[j + 1]; k++)
+            {
+                r = paiArows[k];
+                if(paiPos[r] >= nColBeg)
+                {
+                    padAcoef[paiPos[r]] += padAcoef[k];
+                }
+                else
+                {
+                    paiPos[r] = nPos;
+                    paiArows[nPos] = r;
+                    padAcoef[nPos] = padAcoef[k];
+                    nPos++;
+                }
+            }
+            paiAcols[j] = nColBeg;
+        }
+        paiAcols[nVars] = nPos;
+        nAnnz = nPos;
+    }
+    else
+    {
+        error("rLindo Error: arg#7 is required to be a dgCMatrix, dgTMatrix, triplet list or numeric matrix");
+    }
+
+    rDropNameIndex(prModel);
+
+    *pnErrorCode = LSloadLPData(pModel,
+                                nCons,
+                                nVars,
+                                nObjSense,
+                                dObjConst,
+                                padC,
+                                padB,
+                                pszConTypes,
+                                nAnnz,
+                                paiAcols,
+                                NULL,
+                                padAcoef,
+                                paiArows,
+                                padL,
+                                padU);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSgetLPSparse
+* @param[in] sModel
+* @return int An integer error code
+* @remark ErrorCode,nObjSense,dObjConst,A,padB,paszConTypes,padC,padL,padU
+*         = rLSgetLPSparse(model). A is a dgCMatrix; its slots are filled by
+*         LSgetLPData directly. The Matrix package must be loaded.
+*/
+SEXP rcLSgetLPSparse(SEXP  sModel)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spnObjSense = R_NilValue;
+    SEXP      spdObjConst = R_NilValue;
+    SEXP      sA = R_NilValue;
+    SEXP      spaiAcols = R_NilValue;
+    SEXP      spaiArows = R_NilValue;
+    SEXP      spadAcoef = R_NilValue;
+    SEXP      spanDim = R_NilValue;
+    SEXP      spadB = R_NilValue;
+    SEXP      spaszConTypes = R_NilValue;
+    SEXP      spadC = R_NilValue;
+    SEXP      spadL = R_NilValue;
+    SEXP      spadU = R_NilValue;
+    char      *pachConTypes;
+    int       *paiAcols, *panAcols, *paiArows;
+    double    *padAcoef;
+    SEXP      rList = R_NilValue;
+    char      *Names[9] = {"ErrorCode", "nObjSense", "dObjConst", "A", "padB",
+                           "paszConTypes", "padC", "padL", "padU"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 9;
+    int       nProtect = 0;
+    int       nCons, nVars, nNnz, j, k, nPos;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    *pnErrorCode = LSgetInfo(pModel,LS_IINFO_NUM_CONS,&nCons);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetInfo(pModel,LS_IINFO_NUM_VARS,&nVars);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetInfo(pModel,LS_IINFO_NUM_NONZ,&nNnz);
+    CHECK_ERRCODE;
+
+    PROTECT(sA = R_do_new_object(R_do_MAKE_CLASS("dgCMatrix")));
+    PROTECT(spnObjSense = NEW_INTEGER(1));
+    PROTECT(spdObjConst = NEW_NUMERIC(1));
+    PROTECT(spaiAcols = NEW_INTEGER(nVars+1));
+    PROTECT(spaiArows = NEW_INTEGER(nNnz));
+    PROTECT(spadAcoef = NEW_NUMERIC(nNnz));
+    PROTECT(spadB = NEW_NUMERIC(nCons));
+    PROTECT(spaszConTypes = NEW_CHARACTER(nCons));
+    PROTECT(spadC = NEW_NUMERIC(nVars));
+    PROTECT(spadL = NEW_NUMERIC(nVars));
+    PROTECT(spadU = NEW_NUMERIC(nVars));
+    nProtect += 11;
+
+    paiAcols = INTEGER_POINTER(spaiAcols);
+    paiArows = INTEGER_POINTER(spaiArows);
+    padAcoef = NUMERIC_POINTER(spadAcoef);
+    panAcols = (int*)R_alloc(nVars > 0 ? nVars : 1, sizeof(int));
+    pachConTypes = R_alloc(nCons+1, sizeof(char));
+    pachConTypes[nCons] = '\0';
+
+    *pnErrorCode = LSgetLPData(pModel,
+                               INTEGER_POINTER(spnObjSense),
+                               NUMERIC_POINTER(spdObjConst),
+                               NUMERIC_POINTER(spadC),
+                               NUMERIC_POINTER(spadB),
+                               pachConTypes,
+                               paiAcols,
+                               panAcols,
+                               padAcoef,
+                               paiArows,
+                               NUMERIC_POINTER(spadL),
+                               NUMERIC_POINTER(spadU));
+    CHECK_ERRCODE;
+
+    /* close any gaps between columns, a dgCMatrix has to be compact */
+    nPos = 0;
+    for(j = 0; j < nVars; j++)
+    {
+        int nBeg = paiAcols[j];
+
+        paiAcols[j] = nPos;
+        if(nBeg != nPos)
+        {
+            for(k = 0; k < panAcols[j]; k++)
+            {
+                paiArows[nPos + k] = paiArows[nBeg + k];
+                padAcoef[nPos + k] = padAcoef[nBeg + k];
+            }
+        }
+        nPos += panAcols[j];
+    }
+    paiAcols[nVars] = nPos;
+    if(nPos != nNnz)
+    {
+        PROTECT(spaiArows = lengthgets(spaiArows, nPos));
+        PROTECT(spadAcoef = lengthgets(spadAcoef, nPos));
+        nProtect += 2;
+    }
+
+    PROTECT(spanDim = NEW_INTEGER(2));
+    nProtect += 1;
+    INTEGER(spanDim)[0] = nCons;
+    INTEGER(spanDim)[1] = nVars;
+
+    SET_SLOT(sA, install("i"), spaiArows);
+    SET_SLOT(sA, install("p"), spaiAcols);
+    SET_SLOT(sA, install("x"), spadAcoef);
+    SET_SLOT(sA, install("Dim"), spanDim);
+
+    for(k = 0; k < nCons; k++)
+    {
+        SET_STRING_ELT(spaszConTypes, k, mkCharLen(pachConTypes + k, 1));
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spnObjSense);
+        SET_VECTOR_ELT(rList, 2, spdObjConst);
+        SET_VECTOR_ELT(rList, 3, sA);
+        SET_VECTOR_ELT(rList, 4, spadB);
+        SET_VECTOR_ELT(rList, 5, spaszConTypes);
+        SET_VECTOR_ELT(rList, 6, spadC);
+        SET_VECTOR_ELT(rList, 7, spadL);
+        SET_VECTOR_ELT(rList, 8, spadU);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/* Grows a builder buffer to hold at least nNeed items, returns 0 or an
+   error code. The capacity is updated by the caller once every buffer of
+   a group has grown. */
+static int rGrowBuf(void   **ppBuf,
+                    int    nNeed,
+                    size_t nSize)
+{
+    void *pNew = realloc(*ppBuf, (size_t)(nNeed > 0 ? nNeed : 1) * nSize);
+
+    if(pNew == NULL)
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+    *ppBuf = pNew;
+
+    return LSERR_NO_ERROR;
+}
+
+static int rNextCap(int nCap, int nNeed)
+{
+    if(nCap < 16)
+    {
+        nCap = 16;
+    }
+    while(nCap < nNeed)
+    {
+        nCap *= 2;
+    }
+
+    return nCap;
+}
+
+static int rBuilderReserveVars(prLSbuilder prBuilder, int nNeed)
+{
+    int nCap;
+
+    if(nNeed <= prBuilder->nVarsCap)
+    {
+        return LSERR_NO_ERROR;
+    }
+
+    nCap = rNextCap(prBuilder->nVarsCap, nNeed);
+    if(rGrowBuf((void**)&prBuilder->padC, nCap, sizeof(double)) ||
+       rGrowBuf((void**)&prBuilder->padL, nCap, sizeof(double)) ||
+       rGrowBuf((void**)&prBuilder->padU, nCap, sizeof(double)) ||
+       rGrowBuf((void**)&prBuilder->pachVarTypes, nCap + 1, sizeof(char)) ||
+       rGrowBuf((void**)&prBuilder->paiVarName, nCap, sizeof(int)))
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+    prBuilder->nVarsCap = nCap;
+
+    return LSERR_NO_ERROR;
+}
+
+static int rBuilderReserveCons(prLSbuilder prBuilder, int nNeed)
+{
+    int nCap;
+
+    if(nNeed <= prBuilder->nConsCap)
+    {
+        return LSERR_NO_ERROR;
+    }
+
+    nCap = rNextCap(prBuilder->nConsCap, nNeed);
+    if(rGrowBuf((void**)&prBuilder->padB, nCap, sizeof(double)) ||
+       rGrowBuf((void**)&prBuilder->pachConTypes, nCap + 1, sizeof(char)) ||
+       rGrowBuf((void**)&prBuilder->paiConName, nCap, sizeof(int)))
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+    prBuilder->nConsCap = nCap;
+
+    return LSERR_NO_ERROR;
+}
+
+static int rBuilderReserveNnz(prLSbuilder prBuilder, int nNeed)
+{
+    int nCap;
+
+    if(nNeed <= prBuilder->nNnzCap)
+    {
+        return LSERR_NO_ERROR;
+    }
+
+    nCap = rNextCap(prBuilder->nNnzCap, nNeed);
+    if(rGrowBuf((void**)&prBuilder->paiRow, nCap, sizeof(int)) ||
+       rGrowBuf((void**)&prBuilder->paiVar, nCap, sizeof(int)) ||
+       rGrowBuf((void**)&prBuilder->padVal, nCap, sizeof(double)))
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+    prBuilder->nNnzCap = nCap;
+
+    return LSERR_NO_ERROR;
+}
+
+/* Copies the names into the name arena, storing their offsets in paiOffset */
+static int rBuilderAddNames(prLSbuilder prBuilder,
+                            SEXP        spaszNames,
+                            int         *paiOffset)
+{
+    int    k, nLen, nNames = Rf_length(spaszNames);
+    size_t nNeed = prBuilder->nNameUsed;
+
+    for(k = 0; k < nNames; k++)
+    {
+        nNeed += strlen(CHAR(STRING_ELT(spaszNames, k))) + 1;
+    }
+    if(nNeed > INT_MAX)
+    {
+        return LSERR_OUT_OF_MEMORY;
+    }
+    if((int)nNeed > prBuilder->nNameCap)
+    {
+        int nCap = rNextCap(prBuilder->nNameCap, (int)nNeed);
+
+        if(rGrowBuf((void**)&prBuilder->pachNames, nCap, sizeof(char)))
+        {
+            return LSERR_OUT_OF_MEMORY;
+        }
+        prBuilder->nNameCap = nCap;
+    }
+
+    for(k = 0; k < nNames; k++)
+    {
+        const char *pszName = CHAR(STRING_ELT(spaszNames, k));
+
+        nLen = (int)strlen(pszName) + 1;
+        memcpy(prBuilder->pachNames + prBuilder->nNameUsed, pszName, nLen);
+        paiOffset[k] = prBuilder->nNameUsed;
+        prBuilder->nNameUsed += nLen;
+    }
+
+    return LSERR_NO_ERROR;
+}
+
+static void rFreeBuilder(prLSbuilder prBuilder)
+{
+    free(prBuilder->padC);
+    free(prBuilder->padL);
+    free(prBuilder->padU);
+    free(prBuilder->pachVarTypes);
+    free(prBuilder->paiVarName);
+    free(prBuilder->padB);
+    free(prBuilder->pachConTypes);
+    free(prBuilder->paiConName);
+    free(prBuilder->paiRow);
+    free(prBuilder->paiVar);
+    free(prBuilder->padVal);
+    free(prBuilder->pachNames);
+    free(prBuilder);
+}
+
+static void rFinalizeBuilder(SEXP sBuilder)
+{
+    prLSbuilder prBuilder = (prLSbuilder)R_ExternalPtrAddr(sBuilder);
+
+    if(prBuilder != NULL)
+    {
+        rFreeBuilder(prBuilder);
+        R_ClearExternalPtr(sBuilder);
+    }
+}
+
+/*
+* @brief rcLScreateBuilder
+* @param[in] sModel      model the staged rows and columns will be added to
+* @param[in] snVarsHint  expected number of variables, sizes the buffers
+* @param[in] snConsHint  expected number of constraints
+* @param[in] snNnzHint   expected number of nonzeros
+* @return a builder object, NULL on failure
+*/
+SEXP rcLScreateBuilder(SEXP sModel, SEXP snVarsHint, SEXP snConsHint, SEXP snNnzHint)
+{
+    prLSmodel   prModel;
+    pLSmodel    pModel;
+    prLSbuilder prBuilder = NULL;
+    int         nErrorCode = LSERR_NO_ERROR;
+    int         *pnErrorCode = &nErrorCode;
+    SEXP        sBuilder = R_NilValue;
+
+    CHECK_MODEL_ERROR;
+
+    prBuilder = (prLSbuilder)calloc(1, sizeof(rLSbuilder));
+    if(prBuilder == NULL)
+    {
+        nErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
+    }
+
+    prBuilder->prModel = prModel;
+    nErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_VARS, &prBuilder->nVars0);
+    if(nErrorCode == LSERR_NO_ERROR)
+    {
+        nErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_CONS, &prBuilder->nCons0);
+    }
+    if(nErrorCode == LSERR_NO_ERROR)
+    {
+        nErrorCode = rBuilderReserveVars(prBuilder, Rf_asInteger(snVarsHint) > 0 ? Rf_asInteger(snVarsHint) : 1);
+    }
+    if(nErrorCode == LSERR_NO_ERROR)
+    {
+        nErrorCode = rBuilderReserveCons(prBuilder, Rf_asInteger(snConsHint) > 0 ? Rf_asInteger(snConsHint) : 1);
+    }
+    if(nErrorCode == LSERR_NO_ERROR)
+    {
+        nErrorCode = rBuilderReserveNnz(prBuilder, Rf_asInteger(snNnzHint) > 0 ? Rf_asInteger(snNnzHint) : 1);
+    }
+
+ErrorReturn:
+    if(nErrorCode)
+    {
+        Rprintf("Failed to create builder object (error %d)\n",nErrorCode);
+        R_FlushConsole();
+        if(prBuilder != NULL)
+        {
+            rFreeBuilder(prBuilder);
+        }
+        return R_NilValue;
+    }
+
+    PROTECT(sBuilder = R_MakeExternalPtr(prBuilder,R_NilValue,sModel));
+
+    R_SetExternalPtrTag(sBuilder,tagLSbuilder);
+
+    R_RegisterCFinalizerEx(sBuilder,rFinalizeBuilder,TRUE);
+
+    UNPROTECT(1);
+
+    return sBuilder;
+}
+
+/*
+* @brief rcLSbuilderAddVariables
+* @param[in] sBuilder
+* @param[in] spadC          objective coefficients, its length gives the count
+* @param[in] spadL          lower bounds, NULL for 0
+* @param[in] spadU          upper bounds, NULL for LS_INFINITY
+* @param[in] spszVarTypes   variable types, NULL for continuous
+* @param[in] spaszVarNames  variable names, NULL for default names
+* @return int An integer error code
+* @remark ErrorCode,iFirst = rLSbuilderAddVariables(builder,padC,padL,padU,pszVarTypes,paszVarNames)
+*/
+SEXP rcLSbuilderAddVariables(SEXP sBuilder, SEXP spadC, SEXP spadL, SEXP spadU,
+                             SEXP spszVarTypes, SEXP spaszVarNames)
+{
+    prLSbuilder prBuilder;
+    int       nAdd = Rf_length(spadC);
+    int       k, nFirst;
+    double    *padL, *padU;
+    char      *pszVarTypes;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spiFirst = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "iFirst"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    if(!isNull(spszVarTypes) && (!isString(spszVarTypes) || Rf_length(spszVarTypes) != 1))
+    {
+        error("rLindo Error: pszVarTypes is required to be a single string");
+    }
+
+    MAKE_REAL_ARRAY(padL,spadL);
+    MAKE_REAL_ARRAY(padU,spadU);
+    MAKE_CHAR_ARRAY(pszVarTypes,spszVarTypes);
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_BUILDER_ERROR;
+
+    if((padL && Rf_length(spadL) != nAdd) || (padU && Rf_length(spadU) != nAdd) ||
+       (pszVarTypes && (int)strlen(pszVarTypes) != nAdd) ||
+       (!isNull(spaszVarNames) && Rf_length(spaszVarNames) != nAdd))
+    {
+        error("rLindo Error: padL, padU, pszVarTypes and paszVarNames must have one entry per variable");
+    }
+    /* names are passed to LINDO API for all variables or for none */
+    if(prBuilder->nVars > 0 && prBuilder->bVarNames != !isNull(spaszVarNames))
+    {
+        error("rLindo Error: names must be given for all staged variables or for none");
+    }
+
+    *pnErrorCode = rBuilderReserveVars(prBuilder, prBuilder->nVars + nAdd);
+    CHECK_ERRCODE;
+
+    nFirst = prBuilder->nVars;
+    if(!isNull(spaszVarNames))
+    {
+        *pnErrorCode = rBuilderAddNames(prBuilder, spaszVarNames, prBuilder->paiVarName + nFirst);
+        CHECK_ERRCODE;
+    }
+    prBuilder->bVarNames = !isNull(spaszVarNames);
+
+    memcpy(prBuilder->padC + nFirst, REAL(spadC), nAdd * sizeof(double));
+    for(k = 0; k < nAdd; k++)
+    {
+        prBuilder->padL[nFirst + k] = padL ? padL[k] : 0.0;
+        prBuilder->padU[nFirst + k] = padU ? padU[k] : LS_INFINITY;
+        prBuilder->pachVarTypes[nFirst + k] = pszVarTypes ? pszVarTypes[k] : LS_VARTYPE_CONT;
+    }
+    prBuilder->nVars += nAdd;
+
+    PROTECT(spiFirst = ScalarInteger(prBuilder->nVars0 + nFirst));
+    nProtect += 1;
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spiFirst);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSbuilderAddConstraints
+* @param[in] sBuilder
+* @param[in] spszConTypes   constraint types, one character per constraint
+* @param[in] spadB          right-hand sides, its length gives the count
+* @param[in] spaszConNames  constraint names, NULL for default names
+* @return int An integer error code
+* @remark ErrorCode,iFirst = rLSbuilderAddConstraints(builder,pszConTypes,padB,paszConNames)
+*/
+SEXP rcLSbuilderAddConstraints(SEXP sBuilder, SEXP spszConTypes, SEXP spadB,
+                               SEXP spaszConNames)
+{
+    prLSbuilder prBuilder;
+    int       nAdd = Rf_length(spadB);
+    int       nFirst;
+    char      *pszConTypes;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spiFirst = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "iFirst"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_BUILDER_ERROR;
+
+    if(!isString(spszConTypes) || Rf_length(spszConTypes) != 1 ||
+       (int)strlen(CHAR(STRING_ELT(spszConTypes,0))) != nAdd ||
+       (!isNull(spaszConNames) && Rf_length(spaszConNames) != nAdd))
+    {
+        error("rLindo Error: pszConTypes and paszConNames must have one entry per constraint");
+    }
+    pszConTypes = (char *) CHAR(STRING_ELT(spszConTypes,0));
+    if(prBuilder->nCons > 0 && prBuilder->bConNames != !isNull(spaszConNames))
+    {
+        error("rLindo Error: names must be given for all staged constraints or for none");
+    }
+
+    *pnErrorCode = rBuilderReserveCons(prBuilder, prBuilder->nCons + nAdd);
+    CHECK_ERRCODE;
+
+    nFirst = prBuilder->nCons;
+    if(!isNull(spaszConNames))
+    {
+        *pnErrorCode = rBuilderAddNames(prBuilder, spaszConNames, prBuilder->paiConName + nFirst);
+        CHECK_ERRCODE;
+    }
+    prBuilder->bConNames = !isNull(spaszConNames);
+
+    memcpy(prBuilder->padB + nFirst, REAL(spadB), nAdd * sizeof(double));
+    memcpy(prBuilder->pachConTypes + nFirst, pszConTypes, nAdd);
+    prBuilder->nCons += nAdd;
+
+    PROTECT(spiFirst = ScalarInteger(prBuilder->nCons0 + nFirst));
+    nProtect += 1;
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spiFirst);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSbuilderAddCoefs
+* @param[in] sBuilder
+* @param[in] spaiRows  constraint indices
+* @param[in] spaiVars  variable indices
+* @param[in] spadVals  coefficients, entries repeating a (row, var) pair are summed
+* @return int An integer error code
+* @remark ErrorCode = rLSbuilderAddCoefs(builder,paiRows,paiVars,padVals)
+*/
+SEXP rcLSbuilderAddCoefs(SEXP sBuilder, SEXP spaiRows, SEXP spaiVars, SEXP spadVals)
+{
+    prLSbuilder prBuilder;
+    int       nAdd = Rf_length(spadVals);
+    int       k, nRows, nVars;
+    int       *paiRows = INTEGER(spaiRows);
+    int       *paiVars = INTEGER(spaiVars);
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_BUILDER_ERROR;
+
+    if(Rf_length(spaiRows) != nAdd || Rf_length(spaiVars) != nAdd)
+    {
+        error("rLindo Error: paiRows, paiVars and padVals must have the same length");
+    }
+
+    /* rows and columns have to be staged before their coefficients */
+    nRows = prBuilder->nCons0 + prBuilder->nCons;
+    nVars = prBuilder->nVars0 + prBuilder->nVars;
+    for(k = 0; k < nAdd; k++)
+    {
+        if(paiRows[k] < 0 || paiRows[k] >= nRows || paiVars[k] < 0 || paiVars[k] >= nVars ||
+           (paiRows[k] < prBuilder->nCons0 && paiVars[k] < prBuilder->nVars0))
+        {
+            *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+            goto ErrorReturn;
+        }
+    }
+
+    *pnErrorCode = rBuilderReserveNnz(prBuilder, prBuilder->nNnz + nAdd);
+    CHECK_ERRCODE;
+
+    memcpy(prBuilder->paiRow + prBuilder->nNnz, paiRows, nAdd * sizeof(int));
+    memcpy(prBuilder->paiVar + prBuilder->nNnz, paiVars, nAdd * sizeof(int));
+    memcpy(prBuilder->padVal + prBuilder->nNnz, REAL(spadVals), nAdd * sizeof(double));
+    prBuilder->nNnz += nAdd;
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/* Returns an R_alloc'd array of pointers into the builder's name arena */
+static char **rBuilderNames(prLSbuilder prBuilder, int *paiOffset, int nNames)
+{
+    char **paszNames = (char**)R_alloc(nNames > 0 ? nNames : 1, sizeof(char*));
+    int  k;
+
+    for(k = 0; k < nNames; k++)
+    {
+        paszNames[k] = prBuilder->pachNames + paiOffset[k];
+    }
+
+    return paszNames;
+}
+
+/* Deletes the nDel variables (or constraints) from iFirst on, used to undo a
+   partly applied commit */
+static void rDeleteRange(pLSmodel pModel, int bCons, int iFirst, int nDel)
+{
+    int *paiDel = (int*)R_alloc(nDel > 0 ? nDel : 1, sizeof(int));
+    int k;
+
+    for(k = 0; k < nDel; k++)
+    {
+        paiDel[k] = iFirst + k;
+    }
+    if(bCons)
+    {
+        LSdeleteConstraints(pModel, nDel, paiDel);
+    }
+    else
+    {
+        LSdeleteVariables(pModel, nDel, paiDel);
+    }
+}
+
+/*
+* @brief rcLSbuilderCommit
+* @param[in] sBuilder
+* @param[in] sModel      the model the builder was created for, any other is
+*                        rejected
+* @param[in] snObjSense  objective sense, used when the model was empty
+* @param[in] sdObjConst  objective constant, used when the model was empty
+* @return int An integer error code
+* @remark An empty model is loaded with one LSloadLPData call. Otherwise the
+*         staged variables are appended with LSaddVariables and the staged
+*         constraints with LSaddConstraints. The builder is emptied on
+*         success and can stage the next batch. On failure the rows and
+*         columns added by this commit are deleted again and the builder
+*         keeps its staged data.
+*/
+SEXP rcLSbuilderCommit(SEXP sBuilder, SEXP sModel, SEXP snObjSense, SEXP sdObjConst)
+{
+    prLSbuilder prBuilder;
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nObjSense = Rf_asInteger(snObjSense);
+    double    dObjConst = Rf_asReal(sdObjConst);
+    int       nVars0, nCons0, nVarsNow = 0, nConsNow = 0, nNnzNow = 0;
+    int       nVars, nCons, k, j, r, nPos, nNnz = 0;
+    int       nVarsDone = 0, nConsDone = 0;
+    int       *paiColBeg, *paiRowIdx, *paiMark, *paiSlot;
+    double    *padCoef;
+    char      **paszVarNames = NULL, **paszConNames = NULL;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_BUILDER_ERROR;
+
+    CHECK_MODEL_ERROR;
+
+    /* the builder keeps its model's handle, cleared if that model was deleted */
+    if(prModel != prBuilder->prModel ||
+       R_ExternalPtrAddr(R_ExternalPtrProtected(sBuilder)) != prModel)
+    {
+        error("rLindo Error: the builder was created for another model");
+    }
+
+    nVars0 = prBuilder->nVars0;
+    nCons0 = prBuilder->nCons0;
+    nVars = nVars0 + prBuilder->nVars;
+    nCons = nCons0 + prBuilder->nCons;
+
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_VARS, &nVarsNow);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_CONS, &nConsNow);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_NONZ, &nNnzNow);
+    CHECK_ERRCODE;
+    if(nVarsNow != nVars0 || nConsNow != nCons0)
+    {
+        error("rLindo Error: the model has changed since the builder was created or last committed");
+    }
+
+    /* sort the staged coefficients by column, summing repeated (row, var)
+       entries in place with a per-row marker of the column last seen */
+    paiColBeg = (int*)R_alloc(nVars + 1, sizeof(int));
+    paiRowIdx = (int*)R_alloc(prBuilder->nNnz > 0 ? prBuilder->nNnz : 1, sizeof(int));
+    padCoef = (double*)R_alloc(prBuilder->nNnz > 0 ? prBuilder->nNnz : 1, sizeof(double));
+    paiMark = (int*)R_alloc(nCons > 0 ? nCons : 1, sizeof(int));
+    paiSlot = (int*)R_alloc(nCons > 0 ? nCons : 1, sizeof(int));
+
+    memset(paiColBeg, 0, (nVars + 1) * sizeof(int));
+    for(k = 0; k < prBuilder->nNnz; k++)
+    {
+        paiColBeg[prBuilder->paiVar[k] + 1]++;
+    }
+    for(j = 0; j < nVars; j++)
+    {
+        paiColBeg[j + 1] += paiColBeg[j];
+    }
+    for(k = 0; k < prBuilder->nNnz; k++)
+    {
+        nPos = paiColBeg[prBuilder->paiVar[k]]++;
+        paiRowIdx[nPos] = prBuilder->paiRow[k];
+        padCoef[nPos] = prBuilder->padVal[k];
+    }
+    for(j = nVars; j > 0; j--)
+    {
+        paiColBeg[j] = paiColBeg[j - 1];
+    }
+    paiColBeg[0] = 0;
+
+    for(r = 0; r < nCons; r++)
+    {
+        paiMark[r] = -1;
+    }
+    for(j = 0; j < nVars; j++)
+    {
+        int nBeg = paiColBeg[j], nEnd = paiColBeg[j + 1];
+
+        paiColBeg[j] = nNnz;
+        for(k = nBeg; k < nEnd; k++)
+        {
+            r = paiRowIdx[k];
+            if(paiMark[r] == j)
+            {
+                padCoef[paiSlot[r]] += padCoef[k];
+            }
+            else
+            {
+                paiMark[r] = j;
+                paiSlot[r] = nNnz;
+                paiRowIdx[nNnz] = r;
+                padCoef[nNnz] = padCoef[k];
+                nNnz++;
+            }
+        }
+    }
+    paiColBeg[nVars] = nNnz;
+
+    prBuilder->pachVarTypes[prBuilder->nVars] = '\0';
+    prBuilder->pachConTypes[prBuilder->nCons] = '\0';
+    if(prBuilder->bVarNames)
+    {
+        paszVarNames = rBuilderNames(prBuilder, prBuilder->paiVarName, prBuilder->nVars);
+    }
+    if(prBuilder->bConNames)
+    {
+        paszConNames = rBuilderNames(prBuilder, prBuilder->paiConName, prBuilder->nCons);
+    }
+
+    *pnErrorCode = LSsetProbAllocSizes(pModel, nVars, nCons, 0, nNnzNow + nNnz, 0, 0);
+    CHECK_ERRCODE;
+
+    rDropNameIndex(prModel);
+
+    if(nVars0 == 0 && nCons0 == 0)
+    {
+        *pnErrorCode = LSloadLPData(pModel, nCons, nVars, nObjSense, dObjConst,
+                                    prBuilder->padC, prBuilder->padB, prBuilder->pachConTypes,
+                                    nNnz, paiColBeg, NULL, padCoef, paiRowIdx,
+                                    prBuilder->padL, prBuilder->padU);
+        CHECK_ERRCODE;
+        nVarsDone = nVars;
+        nConsDone = nCons;
+
+        if(strspn(prBuilder->pachVarTypes, "C") != (size_t)nVars)
+        {
+            *pnErrorCode = LSloadVarType(pModel, prBuilder->pachVarTypes);
+            CHECK_ERRCODE;
+        }
+
+        if(paszVarNames || paszConNames)
+        {
+            *pnErrorCode = LSloadNameData(pModel, NULL, NULL, NULL, NULL, NULL,
+                                          paszConNames, paszVarNames, NULL);
+            CHECK_ERRCODE;
+        }
+    }
+    else
+    {
+        int    *paiBeg, *paiIdx, nAdd = 0;
+        double *padAdd;
+
+        /* new columns carry their coefficients in existing rows ... */
+        if(prBuilder->nVars > 0)
+        {
+            paiBeg = (int*)R_alloc(prBuilder->nVars + 1, sizeof(int));
+            paiIdx = (int*)R_alloc(nNnz > 0 ? nNnz : 1, sizeof(int));
+            padAdd = (double*)R_alloc(nNnz > 0 ? nNnz : 1, sizeof(double));
+            for(j = nVars0; j < nVars; j++)
+            {
+                paiBeg[j - nVars0] = nAdd;
+                for(k = paiColBeg[j]; k < paiColBeg[j + 1]; k++)
+                {
+                    if(paiRowIdx[k] < nCons0)
+                    {
+                        paiIdx[nAdd] = paiRowIdx[k];
+                        padAdd[nAdd] = padCoef[k];
+                        nAdd++;
+                    }
+                }
+            }
+            paiBeg[prBuilder->nVars] = nAdd;
+
+            *pnErrorCode = LSaddVariables(pModel, prBuilder->nVars, prBuilder->pachVarTypes,
+                                          paszVarNames, paiBeg, NULL, padAdd, paiIdx,
+                                          prBuilder->padC, prBuilder->padL, prBuilder->padU);
+            CHECK_ERRCODE;
+            nVarsDone = prBuilder->nVars;
+        }
+
+        /* ... and new rows get all of theirs, sorted by row */
+        if(prBuilder->nCons > 0)
+        {
+            paiBeg = (int*)R_alloc(prBuilder->nCons + 1, sizeof(int));
+            paiIdx = (int*)R_alloc(nNnz > 0 ? nNnz : 1, sizeof(int));
+            padAdd = (double*)R_alloc(nNnz > 0 ? nNnz : 1, sizeof(double));
+            memset(paiBeg, 0, (prBuilder->nCons + 1) * sizeof(int));
+            for(k = 0; k < nNnz; k++)
+            {
+                if(paiRowIdx[k] >= nCons0)
+                {
+                    paiBeg[paiRowIdx[k] - nCons0 + 1]++;
+                }
+            }
+            for(r = 0; r < prBuilder->nCons; r++)
+            {
+                paiBeg[r + 1] += paiBeg[r];
+            }
+            for(j = 0; j < nVars; j++)
+            {
+                for(k = paiColBeg[j]; k < paiColBeg[j + 1]; k++)
+                {
+                    if(paiRowIdx[k] >= nCons0)
+                    {
+                        nPos = paiBeg[paiRowIdx[k] - nCons0]++;
+                        paiIdx[nPos] = j;
+                        padAdd[nPos] = padCoef[k];
+                    }
+                }
+            }
+            for(r = prBuilder->nCons; r > 0; r--)
+            {
+                paiBeg[r] = paiBeg[r - 1];
+            }
+            paiBeg[0] = 0;
+
+            *pnErrorCode = LSaddConstraints(pModel, prBuilder->nCons, prBuilder->pachConTypes,
+                                            paszConNames, paiBeg, padAdd, paiIdx,
+                                            prBuilder->padB);
+            CHECK_ERRCODE;
+        }
+    }
+
+    /* the staged rows and columns now belong to the model */
+    prBuilder->nVars0 = nVars;
+    prBuilder->nCons0 = nCons;
+    prBuilder->nVars = 0;
+    prBuilder->nCons = 0;
+    prBuilder->nNnz = 0;
+    prBuilder->nNameUsed = 0;
+    prBuilder->bVarNames = FALSE;
+    prBuilder->bConNames = FALSE;
+
+ErrorReturn:
+    //undo a partly applied commit, leaving the model as it was
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        if(nConsDone > 0)
+        {
+            rDeleteRange(pModel, TRUE, nCons0, nConsDone);
+        }
+        if(nVarsDone > 0)
+        {
+            rDeleteRange(pModel, FALSE, nVars0, nVarsDone);
+        }
+    }
+
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/* Edit kinds of rcLSmodifyBatch */
+#define rLS_EDIT_RHS       0
+#define rLS_EDIT_OBJ       1
+#define rLS_EDIT_LB        2
+#define rLS_EDIT_UB        3
+#define rLS_EDIT_AJ        4
+#define rLS_EDIT_CONTYPE   5
+#define rLS_EDIT_VARTYPE   6
+#define rLS_EDIT_OBJCONST  7
+#define rLS_EDIT_NKINDS    8
+
+typedef struct rLindoAjEdit_t {
+    int    iVar;
+    int    iRow;
+    int    nPos;
+    double dVal;
+} rLindoAjEdit_t;
+
+static int rCompareAjEdit(const void *p1, const void *p2)
+{
+    const rLindoAjEdit_t *pE1 = (const rLindoAjEdit_t*)p1;
+    const rLindoAjEdit_t *pE2 = (const rLindoAjEdit_t*)p2;
+
+    if(pE1->iVar != pE2->iVar)
+    {
+        return pE1->iVar < pE2->iVar ? -1 : 1;
+    }
+
+    return pE1->nPos < pE2->nPos ? -1 : (pE1->nPos > pE2->nPos);
+}
+
+/* Applies a single edit, used to undo edits and to find the one that failed */
+static int rApplyEdit(pLSmodel pModel, int nKind, int iIndex, int iVar, double dValue)
+{
+    char achType[2];
+
+    achType[0] = (char)dValue;
+    achType[1] = '\0';
+
+    switch(nKind)
+    {
+    case rLS_EDIT_RHS:
+        return LSmodifyRHS(pModel, 1, &iIndex, &dValue);
+    case rLS_EDIT_OBJ:
+        return LSmodifyObjective(pModel, 1, &iIndex, &dValue);
+    case rLS_EDIT_LB:
+        return LSmodifyLowerBounds(pModel, 1, &iIndex, &dValue);
+    case rLS_EDIT_UB:
+        return LSmodifyUpperBounds(pModel, 1, &iIndex, &dValue);
+    case rLS_EDIT_AJ:
+        return LSmodifyAj(pModel, iVar, 1, &iIndex, &dValue);
+    case rLS_EDIT_CONTYPE:
+        return LSmodifyConstraintType(pModel, 1, &iIndex, achType);
+    case rLS_EDIT_VARTYPE:
+        return LSmodifyVariableType(pModel, 1, &iIndex, achType);
+    case rLS_EDIT_OBJCONST:
+        return LSmodifyObjConstant(pModel, dValue);
+    }
+
+    return LSERR_ERROR_IN_INPUT;
+}
+
+/* Reads the value an edit is about to overwrite, in the form of the edit.
+   paiRow and padCoef hold one column of the constraint matrix. */
+static int rReadEdit(pLSmodel pModel, int nKind, int iIndex, int iVar,
+                     int *paiRow, double *padCoef, double *pdOld)
+{
+    int    nErrorCode, nAnnz = 0, k;
+    char   chType = 0;
+    double dC = 0.0, dL = 0.0, dU = 0.0;
+
+    switch(nKind)
+    {
+    case rLS_EDIT_RHS:
+    case rLS_EDIT_CONTYPE:
+        nErrorCode = LSgetLPConstraintDatai(pModel, iIndex, &chType, &dC, NULL, NULL, NULL);
+        *pdOld = nKind == rLS_EDIT_RHS ? dC : (double)chType;
+        return nErrorCode;
+    case rLS_EDIT_OBJ:
+    case rLS_EDIT_LB:
+    case rLS_EDIT_UB:
+    case rLS_EDIT_VARTYPE:
+        nErrorCode = LSgetLPVariableDataj(pModel, iIndex, &chType, &dC, &dL, &dU,
+                                          NULL, NULL, NULL);
+        *pdOld = nKind == rLS_EDIT_OBJ ? dC : nKind == rLS_EDIT_LB ? dL :
+                 nKind == rLS_EDIT_UB ? dU : (double)chType;
+        return nErrorCode;
+    case rLS_EDIT_AJ:
+        nErrorCode = LSgetLPVariableDataj(pModel, iVar, NULL, NULL, NULL, NULL,
+                                          &nAnnz, paiRow, padCoef);
+        *pdOld = 0.0;
+        for(k = 0; k < nAnnz; k++)
+        {
+            if(paiRow[k] == iIndex)
+            {
+                *pdOld = padCoef[k];
+                break;
+            }
+        }
+        return nErrorCode;
+    case rLS_EDIT_OBJCONST:
+        return LSgetLPData(pModel, NULL, pdOld, NULL, NULL, NULL, NULL, NULL,
+                           NULL, NULL, NULL, NULL);
+    }
+
+    return LSERR_ERROR_IN_INPUT;
+}
+
+/* Applies nCnt edits of one kind with one LINDO API call, or one call per
+   variable for matrix coefficients */
+static int rApplyRun(pLSmodel pModel,
+                     int      nKind,
+                     int      nCnt,
+                     int      *paiIndex,
+                     int      *paiVar,
+                     double   *padValue)
+{
+    int            nErrorCode = LSERR_NO_ERROR;
+    int            k;
+    int            *paiIdx;
+    double         *padVal;
+    char           *pachType;
+    rLindoAjEdit_t *paAj;
+
+    switch(nKind)
+    {
+    case rLS_EDIT_RHS:
+        return LSmodifyRHS(pModel, nCnt, paiIndex, padValue);
+    case rLS_EDIT_OBJ:
+        return LSmodifyObjective(pModel, nCnt, paiIndex, padValue);
+    case rLS_EDIT_LB:
+        return LSmodifyLowerBounds(pModel, nCnt, paiIndex, padValue);
+    case rLS_EDIT_UB:
+        return LSmodifyUpperBounds(pModel, nCnt, paiIndex, padValue);
+    case rLS_EDIT_AJ:
+        /* one LSmodifyAj call per variable, keeping the order within one */
+        paAj = (rLindoAjEdit_t*)R_alloc(nCnt, sizeof(rLindoAjEdit_t));
+        paiIdx = (int*)R_alloc(nCnt, sizeof(int));
+        padVal = (double*)R_alloc(nCnt, sizeof(double));
+        for(k = 0; k < nCnt; k++)
+        {
+            paAj[k].iVar = paiVar[k];
+            paAj[k].iRow = paiIndex[k];
+            paAj[k].nPos = k;
+            paAj[k].dVal = padValue[k];
+        }
+        qsort(paAj, nCnt, sizeof(rLindoAjEdit_t), rCompareAjEdit);
+        for(k = 0; k < nCnt && nErrorCode == LSERR_NO_ERROR; )
+        {
+            int nRun = 0;
+
+            while(k + nRun < nCnt && paAj[k + nRun].iVar == paAj[k].iVar)
+            {
+                paiIdx[nRun] = paAj[k + nRun].iRow;
+                padVal[nRun] = paAj[k + nRun].dVal;
+                nRun++;
+            }
+            nErrorCode = LSmodifyAj(pModel, paAj[k].iVar, nRun, paiIdx, padVal);
+            k += nRun;
+        }
+        return nErrorCode;
+    case rLS_EDIT_CONTYPE:
+    case rLS_EDIT_VARTYPE:
+        pachType = R_alloc(nCnt + 1, sizeof(char));
+        for(k = 0; k < nCnt; k++)
+        {
+            pachType[k] = (char)padValue[k];
+        }
+        pachType[nCnt] = '\0';
+        if(nKind == rLS_EDIT_CONTYPE)
+        {
+            return LSmodifyConstraintType(pModel, nCnt, paiIndex, pachType);
+        }
+        return LSmodifyVariableType(pModel, nCnt, paiIndex, pachType);
+    case rLS_EDIT_OBJCONST:
+        return LSmodifyObjConstant(pModel, padValue[nCnt - 1]);
+    }
+
+    return LSERR_ERROR_IN_INPUT;
+}
+
+/* Restores the values saved in padOld for edits nEnd-1 down to 0 */
+static void rUndoEdits(pLSmodel pModel,
+                       int      nEnd,
+                       int      *panKind,
+                       int      *paiIndex,
+                       int      *paiVar,
+                       double   *padOld)
+{
+    int k;
+
+    for(k = nEnd - 1; k >= 0; k--)
+    {
+        rApplyEdit(pModel, panKind[k], paiIndex[k], paiVar[k], padOld[k]);
+    }
+}
+
+/* Applies edits in input order, each run of consecutive edits of one kind
+   with one LINDO API call. Returns an error code and sets *piFailed to the
+   failing edit. With bUndo set, the values each run overwrites are read
+   first and a failure restores all of them, so that either every edit is
+   applied or none is. */
+static int rApplyEdits(pLSmodel pModel,
+                       int      nEdits,
+                       int      *panKind,
+                       int      *paiIndex,
+                       int      *paiVar,
+                       double   *padValue,
+                       int      bUndo,
+                       int      *piFailed)
+{
+    int       nBeg, nEnd, nKind, nCons = 0, k;
+    int       nErrorCode = LSERR_NO_ERROR;
+    int       *paiRow = NULL;
+    double    *padOld = NULL, *padCoef = NULL;
+
+    *piFailed = -1;
+
+    for(k = 0; k < nEdits; k++)
+    {
+        if(panKind[k] < 0 || panKind[k] >= rLS_EDIT_NKINDS)
+        {
+            *piFailed = k;
+            return LSERR_ERROR_IN_INPUT;
+        }
+    }
+
+    if(bUndo)
+    {
+        nErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_CONS, &nCons);
+        if(nErrorCode)
+        {
+            return nErrorCode;
+        }
+        padOld = (double*)R_alloc(nEdits > 0 ? nEdits : 1, sizeof(double));
+        paiRow = (int*)R_alloc(nCons > 0 ? nCons : 1, sizeof(int));
+        padCoef = (double*)R_alloc(nCons > 0 ? nCons : 1, sizeof(double));
+    }
+
+    for(nBeg = 0; nBeg < nEdits; nBeg = nEnd)
+    {
+        nKind = panKind[nBeg];
+        nEnd = nBeg + 1;
+        while(nEnd < nEdits && panKind[nEnd] == nKind)
+        {
+            nEnd++;
+        }
+
+        /* read what the run overwrites, this also catches bad indices */
+        for(k = nBeg; bUndo && k < nEnd; k++)
+        {
+            nErrorCode = rReadEdit(pModel, nKind, paiIndex[k], paiVar[k],
+                                   paiRow, padCoef, padOld + k);
+            if(nErrorCode)
+            {
+                *piFailed = k;
+                rUndoEdits(pModel, nBeg, panKind, paiIndex, paiVar, padOld);
+                return nErrorCode;
+            }
+        }
+
+        nErrorCode = rApplyRun(pModel, nKind, nEnd - nBeg, paiIndex + nBeg,
+                               paiVar + nBeg, padValue + nBeg);
+        if(nErrorCode == LSERR_NO_ERROR)
+        {
+            continue;
+        }
+
+        /* replay the run one edit at a time to find the one that fails */
+        *piFailed = nBeg;
+        for(k = nBeg; k < nEnd; k++)
+        {
+            if(rApplyEdit(pModel, nKind, paiIndex[k], paiVar[k], padValue[k]) != LSERR_NO_ERROR)
+            {
+                *piFailed = k;
+                break;
+            }
+        }
+        if(bUndo)
+        {
+            rUndoEdits(pModel, nEnd, panKind, paiIndex, paiVar, padOld);
+        }
+        return nErrorCode;
+    }
+
+    return LSERR_NO_ERROR;
+}
+
+/*
+* @brief rcLSmodifyBatch
+* @param[in] sModel
+* @param[in] spanKind   kind of each edit, rLS_EDIT_*
+* @param[in] spaiIndex  constraint or variable index of each edit, the
+*                       constraint for rLS_EDIT_AJ
+* @param[in] spaiVar    variable of each rLS_EDIT_AJ edit, ignored otherwise
+* @param[in] spadValue  new value; the character code of the new type for
+*                       type edits
+* @return int An integer error code
+* @remark ErrorCode,iEdit = rLSmodifyBatch(model,panKind,paiIndex,paiVar,padValue)
+*         Edits are applied in input order, each run of consecutive edits of
+*         one kind with one LINDO API call. On failure all edits are undone
+*         and iEdit is the edit that failed.
+*/
+SEXP rcLSmodifyBatch(SEXP sModel, SEXP spanKind, SEXP spaiIndex, SEXP spaiVar, SEXP spadValue)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nEdits = Rf_length(spanKind);
+    int       *panKind = INTEGER(spanKind);
+    int       *paiIndex = INTEGER(spaiIndex);
+    int       *paiVar = INTEGER(spaiVar);
+    double    *padValue = REAL(spadValue);
+    int       iFailed = -1;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spiEdit = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "iEdit"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    if(Rf_length(spaiIndex) != nEdits || Rf_length(spaiVar) != nEdits ||
+       Rf_length(spadValue) != nEdits)
+    {
+        error("rLindo Error: panKind, paiIndex, paiVar and padValue must have the same length");
+    }
+
+    *pnErrorCode = rApplyEdits(pModel, nEdits, panKind, paiIndex, paiVar, padValue,
+                               TRUE, &iFailed);
+
+ErrorReturn:
+    PROTECT(spiEdit = ScalarInteger(iFailed));
+    nProtect += 1;
+
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    SET_VECTOR_ELT(rList, 1, spiEdit);
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+#define rLS_SWEEP_RHS  0
+#define rLS_SWEEP_OBJ  1
+
+static int rSweepModify(pLSmodel pModel, int nKind, int nSwept, int *paiIndex, double *padVal)
+{
+    if(nKind == rLS_SWEEP_RHS)
+    {
+        return LSmodifyRHS(pModel, nSwept, paiIndex, padVal);
+    }
+
+    return LSmodifyObjective(pModel, nSwept, paiIndex, padVal);
+}
+
+/*
+* @brief rcLSsolveSweep
+* @param[in] sModel
+* @param[in] snKind       rLS_SWEEP_RHS or rLS_SWEEP_OBJ
+* @param[in] spaiIndex    constraints or variables whose values are swept
+* @param[in] spadValues   matrix with one column of values per point
+* @param[in] snMethod     LP method passed to LSoptimize
+* @param[in] sbWarm       start each solve from the basis of the previous one,
+*                         otherwise from a slack basis
+* @param[in] sbSolutions  also return primal and dual solutions
+* @return int An integer error code
+* @remark ErrorCode,padObj,panStatus,panIter,padTime,padPrimal,padDual
+*         = rLSsolveSweep(model,nKind,paiIndex,padValues,nMethod,bWarm,bSolutions)
+*         The swept values are restored when the sweep ends. If a point
+*         fails, the results of the points before it are returned with the
+*         error code and the remaining points are NA.
+*/
+SEXP rcLSsolveSweep(SEXP sModel, SEXP snKind, SEXP spaiIndex, SEXP spadValues,
+                    SEXP snMethod, SEXP sbWarm, SEXP sbSolutions)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nKind = Rf_asInteger(snKind);
+    int       nSwept = Rf_length(spaiIndex);
+    int       *paiIndex = INTEGER(spaiIndex);
+    double    *padValues = REAL(spadValues);
+    int       nMethod = Rf_asInteger(snMethod);
+    int       bWarm = Rf_asLogical(sbWarm) == TRUE;
+    int       bSolutions = Rf_asLogical(sbSolutions) == TRUE;
+    int       nPoints, nVars = 0, nCons = 0, k, p, bHaveBasis = FALSE;
+    int       *panCstatus, *panRstatus, *panCslack, *panRslack;
+    double    *padBase, dStart;
+    char      chType, chIsNlp;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spadObj = R_NilValue;
+    SEXP      spanStatus = R_NilValue;
+    SEXP      spanIter = R_NilValue;
+    SEXP      spadTime = R_NilValue;
+    SEXP      spadPrimal = R_NilValue;
+    SEXP      spadDual = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[7] = {"ErrorCode", "padObj", "panStatus", "panIter", "padTime",
+                           "padPrimal", "padDual"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 7;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    if(nKind != rLS_SWEEP_RHS && nKind != rLS_SWEEP_OBJ)
+    {
+        error("rLindo Error: nKind must be 0 (rhs) or 1 (objective)");
+    }
+    if(nSwept == 0 || Rf_length(spadValues) % nSwept != 0)
+    {
+        error("rLindo Error: padValues must have one row per swept index");
+    }
+    nPoints = Rf_length(spadValues) / nSwept;
+
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_VARS, &nVars);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_CONS, &nCons);
+    CHECK_ERRCODE;
+
+    /* values to restore at the end */
+    padBase = (double*)R_alloc(nSwept, sizeof(double));
+    for(k = 0; k < nSwept; k++)
+    {
+        if(nKind == rLS_SWEEP_RHS)
+        {
+            *pnErrorCode = LSgetConstraintDatai(pModel, paiIndex[k], &chType, &chIsNlp, padBase + k);
+        }
+        else
+        {
+            *pnErrorCode = LSgetLPVariableDataj(pModel, paiIndex[k], NULL, padBase + k,
+                                                NULL, NULL, NULL, NULL, NULL);
+        }
+        CHECK_ERRCODE;
+    }
+
+    panCstatus = (int*)R_alloc(nVars > 0 ? nVars : 1, sizeof(int));
+    panRstatus = (int*)R_alloc(nCons > 0 ? nCons : 1, sizeof(int));
+    panCslack = (int*)R_alloc(nVars > 0 ? nVars : 1, sizeof(int));
+    panRslack = (int*)R_alloc(nCons > 0 ? nCons : 1, sizeof(int));
+    for(k = 0; k < nVars; k++)
+    {
+        panCslack[k] = LS_BASTYPE_ATLO;
+    }
+    for(k = 0; k < nCons; k++)
+    {
+        panRslack[k] = LS_BASTYPE_BAS;
+    }
+
+    PROTECT(spadObj = NEW_NUMERIC(nPoints));
+    PROTECT(spanStatus = NEW_INTEGER(nPoints));
+    PROTECT(spanIter = NEW_INTEGER(nPoints));
+    PROTECT(spadTime = NEW_NUMERIC(nPoints));
+    nProtect += 4;
+    if(bSolutions)
+    {
+        PROTECT(spadPrimal = allocMatrix(REALSXP, nVars, nPoints));
+        PROTECT(spadDual = allocMatrix(REALSXP, nCons, nPoints));
+        nProtect += 2;
+    }
+
+    /* points not reached because of an error are left NA */
+    for(p = 0; p < nPoints; p++)
+    {
+        REAL(spadObj)[p] = NA_REAL;
+        INTEGER(spanStatus)[p] = NA_INTEGER;
+        INTEGER(spanIter)[p] = NA_INTEGER;
+        REAL(spadTime)[p] = NA_REAL;
+    }
+    for(k = 0; bSolutions && k < nVars * nPoints; k++)
+    {
+        REAL(spadPrimal)[k] = NA_REAL;
+    }
+    for(k = 0; bSolutions && k < nCons * nPoints; k++)
+    {
+        REAL(spadDual)[k] = NA_REAL;
+    }
+
+    rSyncCbDims(prModel);
+
+    for(p = 0; p < nPoints; p++)
+    {
+        int nStatus = 0, nSim = 0, nBar = 0, nNlp = 0;
+
+        *pnErrorCode = rSweepModify(pModel, nKind, nSwept, paiIndex, padValues + (size_t)p * nSwept);
+        if(*pnErrorCode) break;
+
+        dStart = rMonotonicMs();
+        if(bWarm && bHaveBasis)
+        {
+            *pnErrorCode = LSloadBasis(pModel, panCstatus, panRstatus);
+        }
+        else if(!bWarm)
+        {
+            *pnErrorCode = LSloadBasis(pModel, panCslack, panRslack);
+        }
+        if(*pnErrorCode) break;
+
+        *pnErrorCode = LSoptimize(pModel, nMethod, &nStatus);
+        if(*pnErrorCode) break;
+        REAL(spadTime)[p] = (rMonotonicMs() - dStart) / 1000.0;
+
+        INTEGER(spanStatus)[p] = nStatus;
+        LSgetInfo(pModel, LS_IINFO_SIM_ITER, &nSim);
+        LSgetInfo(pModel, LS_IINFO_BAR_ITER, &nBar);
+        LSgetInfo(pModel, LS_IINFO_NLP_ITER, &nNlp);
+        INTEGER(spanIter)[p] = nSim + nBar + nNlp;
+
+        if(LSgetInfo(pModel, LS_DINFO_POBJ, REAL(spadObj) + p) != LSERR_NO_ERROR)
+        {
+            REAL(spadObj)[p] = NA_REAL;
+        }
+        if(bSolutions)
+        {
+            if(LSgetPrimalSolution(pModel, REAL(spadPrimal) + (size_t)p * nVars) != LSERR_NO_ERROR)
+            {
+                for(k = 0; k < nVars; k++) REAL(spadPrimal)[(size_t)p * nVars + k] = NA_REAL;
+            }
+            if(LSgetDualSolution(pModel, REAL(spadDual) + (size_t)p * nCons) != LSERR_NO_ERROR)
+            {
+                for(k = 0; k < nCons; k++) REAL(spadDual)[(size_t)p * nCons + k] = NA_REAL;
+            }
+        }
+
+        /* keep the last basis the solver produced for the next point */
+        if(bWarm)
+        {
+            bHaveBasis = LSgetBasis(pModel, panCstatus, panRstatus) == LSERR_NO_ERROR;
+        }
+    }
+
+    rFlushLogBuf(prModel);
+
+    /* restore the swept values, keeping the first error */
+    if(*pnErrorCode)
+    {
+        rSweepModify(pModel, nKind, nSwept, paiIndex, padBase);
+    }
+    else
+    {
+        *pnErrorCode = rSweepModify(pModel, nKind, nSwept, paiIndex, padBase);
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    //results of the points solved before an error are kept
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    SET_VECTOR_ELT(rList, 1, spadObj);
+    SET_VECTOR_ELT(rList, 2, spanStatus);
+    SET_VECTOR_ELT(rList, 3, spanIter);
+    SET_VECTOR_ELT(rList, 4, spadTime);
+    SET_VECTOR_ELT(rList, 5, spadPrimal);
+    SET_VECTOR_ELT(rList, 6, spadDual);
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+
+/* An R log function of the env must not run while native threads solve
+   models of it. Holds nest; the last release reinstalls the function. */
+static void rHoldEnvLog(prLSenv prEnv)
+{
+    if(prEnv->nLogHolds++ == 0 && prEnv->pCbData != NULL &&
+       prEnv->pCbData->locFunc != NULL)
+    {
+        LSsetEnvLogfunc(prEnv->pEnv, NULL, NULL);
+    }
+}
+
+static void rReleaseEnvLog(prLSenv prEnv)
+{
+    if(--prEnv->nLogHolds == 0 && prEnv->pCbData != NULL &&
+       prEnv->pCbData->locFunc != NULL)
+    {
+        LSsetEnvLogfunc(prEnv->pEnv, relayLogfuncEnv, prEnv->pCbData);
+    }
+}
+
+/* Shared state of a solve pool. Workers claim variants through nNext and
+   write only to their own slots of the result arrays. */
+typedef struct rLindoPool_t {
+    rMutex_t lock;
+    int      nNext;
+    int      nJobs;
+    pLSmodel *papModel;
+    int      *pabMIP;
+    int      nMethod;
+    int      nVars;
+    int      *panErr;
+    int      *panStatus;
+    double   *padObj;
+    double   *padTime;
+    double   *padPrimal;   /* nVars by nJobs, NULL if not requested */
+    double   dNA;          /* NA_REAL, read on the calling thread */
+} rLindoPool_t;
+
+RTHREAD_FUNC(rPoolWorker)
+{
+    rLindoPool_t *pPool = (rLindoPool_t*)pArg;
+    pLSmodel     pClone;
+    int          k, j, nErr, nStatus;
+    double       dStart;
+
+    for(;;)
+    {
+        rMutexLock(&pPool->lock);
+        k = pPool->nNext++;
+        rMutexUnlock(&pPool->lock);
+        if(k >= pPool->nJobs) break;
+
+        pClone = pPool->papModel[k];
+        if(pClone == NULL) continue;
+
+        nStatus = 0;
+        dStart = rMonotonicMs();
+        if(pPool->pabMIP[k])
+        {
+            nErr = LSsolveMIP(pClone, &nStatus);
+        }
+        else
+        {
+            nErr = LSoptimize(pClone, pPool->nMethod, &nStatus);
+        }
+        pPool->padTime[k] = (rMonotonicMs() - dStart) / 1000.0;
+        pPool->panErr[k] = nErr;
+        pPool->panStatus[k] = nStatus;
+        if(nErr) continue;
+
+        if(LSgetInfo(pClone, pPool->pabMIP[k] ? LS_DINFO_MIP_OBJ : LS_DINFO_POBJ,
+                     pPool->padObj + k) != LSERR_NO_ERROR)
+        {
+            pPool->padObj[k] = pPool->dNA;
+        }
+        if(pPool->padPrimal)
+        {
+            double *padX = pPool->padPrimal + (size_t)k * pPool->nVars;
+
+            nErr = pPool->pabMIP[k] ? LSgetMIPPrimalSolution(pClone, padX)
+                                    : LSgetPrimalSolution(pClone, padX);
+            if(nErr != LSERR_NO_ERROR)
+            {
+                for(j = 0; j < pPool->nVars; j++) padX[j] = pPool->dNA;
+            }
+        }
+    }
+
+    RTHREAD_RETURN;
+}
+
+/*
+* @brief rcLSsolvePool
+* @param[in] sModel          The base model, left unchanged
+* @param[in] snVariants      Number of variants to solve
+* @param[in] spanVariant     Variant of each edit, 0-based
+* @param[in] spanKind        Kind of each edit, as in rcLSmodifyBatch
+* @param[in] spaiIndex       Constraint or variable index of each edit
+* @param[in] spaiVar         Variable index of coefficient edits, otherwise ignored
+* @param[in] spadValue       New value of each edit
+* @param[in] snThreads       Number of solver threads
+* @param[in] snMethod        LP method passed to LSoptimize
+* @param[in] snSolverType    Solver type passed to LScopyParam
+* @param[in] sbSolutions     Whether to return the primal solution of each variant
+* @return int An integer error code
+* @remark ErrorCode,panErrorCode,panStatus,padObj,padTime,padPrimal =
+*         rLSsolvePool(model,nVariants,panVariant,panKind,paiIndex,paiVar,padValue,
+*                      nThreads,nMethod,nSolverType,bSolutions)
+*/
+SEXP rcLSsolvePool(SEXP sModel, SEXP snVariants, SEXP spanVariant, SEXP spanKind,
+                   SEXP spaiIndex, SEXP spaiVar, SEXP spadValue, SEXP snThreads,
+                   SEXP snMethod, SEXP snSolverType, SEXP sbSolutions)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    pLSenv    pEnv;
+    int       nVariants = Rf_asInteger(snVariants);
+    int       nEdits = Rf_length(spanKind);
+    int       *panVariant = INTEGER(spanVariant);
+    int       nThreads = Rf_asInteger(snThreads);
+    int       nSolverType = Rf_asInteger(snSolverType);
+    int       bSolutions = Rf_asLogical(sbSolutions) == TRUE;
+    int       nVars = 0, nCons = 0, nNnz = 0, nOther, nCount, nStarted = 0;
+    int       nObjSense, *paiAcols, *panAcols, *paiArows, *panBeg, *panPos;
+    int       *panKind, *paiIndex, *paiVar, nInt, nBin;
+    int       k, e, nErr, iFailed;
+    double    dObjConst, *padC, *padB, *padAcoef, *padL, *padU, *padValue;
+    char      *pachConTypes, *pachVarTypes;
+    int       anOtherInfo[] = {LS_IINFO_NUM_QC_NONZ, LS_IINFO_NUM_NLP_CONS,
+                               LS_IINFO_NUM_NLP_VARS, LS_IINFO_NUM_CONES,
+                               LS_IINFO_NUM_SETS, LS_IINFO_NUM_SEMICONT,
+                               LS_IINFO_NUM_ALLDIFF};
+    rLindoPool_t  pool;
+    rThread_t     *paThread;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spanErr = R_NilValue;
+    SEXP      spanStatus = R_NilValue;
+    SEXP      spadObj = R_NilValue;
+    SEXP      spadTime = R_NilValue;
+    SEXP      spadPrimal = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[6] = {"ErrorCode", "panErrorCode", "panStatus", "padObj",
+                           "padTime", "padPrimal"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 6;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    if(nVariants == NA_INTEGER || nVariants < 1)
+    {
+        error("rLindo Error: nVariants must be positive");
+    }
+    if(Rf_length(spanVariant) != nEdits || Rf_length(spaiIndex) != nEdits ||
+       Rf_length(spaiVar) != nEdits || Rf_length(spadValue) != nEdits)
+    {
+        error("rLindo Error: panVariant, panKind, paiIndex, paiVar and padValue must have the same length");
+    }
+    for(e = 0; e < nEdits; e++)
+    {
+        if(panVariant[e] == NA_INTEGER || panVariant[e] < 0 || panVariant[e] >= nVariants)
+        {
+            error("rLindo Error: panVariant must be in 0..nVariants-1");
+        }
+    }
+    if(nThreads == NA_INTEGER || nThreads < 1)
+    {
+        nThreads = 1;
+    }
+    if(nThreads > nVariants)
+    {
+        nThreads = nVariants;
+    }
+    pEnv = prModel->prEnv->pEnv;
+
+    /* clones carry LP and integer data only, anything else in the model
+       would be dropped from them */
+    nCount = 0;
+    for(k = 0; k < (int)(sizeof(anOtherInfo) / sizeof(anOtherInfo[0])); k++)
+    {
+        *pnErrorCode = LSgetInfo(pModel, anOtherInfo[k], &nOther);
+        CHECK_ERRCODE;
+        nCount += nOther;
+    }
+    if(nCount > 0)
+    {
+        *pnErrorCode = LSERR_NOT_SUPPORTED;
+        goto ErrorReturn;
+    }
+
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_VARS, &nVars);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_CONS, &nCons);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_NONZ, &nNnz);
+    CHECK_ERRCODE;
+
+    padC = (double*)R_alloc(nVars + 1, sizeof(double));
+    padL = (double*)R_alloc(nVars + 1, sizeof(double));
+    padU = (double*)R_alloc(nVars + 1, sizeof(double));
+    paiAcols = (int*)R_alloc(nVars + 1, sizeof(int));
+    panAcols = (int*)R_alloc(nVars + 1, sizeof(int));
+    pachVarTypes = R_alloc(nVars + 1, sizeof(char));
+    padB = (double*)R_alloc(nCons + 1, sizeof(double));
+    pachConTypes = R_alloc(nCons + 1, sizeof(char));
+    padAcoef = (double*)R_alloc(nNnz + 1, sizeof(double));
+    paiArows = (int*)R_alloc(nNnz + 1, sizeof(int));
+
+    *pnErrorCode = LSgetLPData(pModel, &nObjSense, &dObjConst, padC, padB, pachConTypes,
+                               paiAcols, panAcols, padAcoef, paiArows, padL, padU);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetVarType(pModel, pachVarTypes);
+    CHECK_ERRCODE;
+
+    /* group the edits by variant, keeping their order within a variant */
+    panBeg = (int*)R_alloc(nVariants + 1, sizeof(int));
+    panPos = (int*)R_alloc(nVariants, sizeof(int));
+    memset(panBeg, 0, (nVariants + 1) * sizeof(int));
+    for(e = 0; e < nEdits; e++)
+    {
+        panBeg[panVariant[e] + 1]++;
+    }
+    for(k = 0; k < nVariants; k++)
+    {
+        panBeg[k + 1] += panBeg[k];
+        panPos[k] = panBeg[k];
+    }
+    panKind = (int*)R_alloc(nEdits + 1, sizeof(int));
+    paiIndex = (int*)R_alloc(nEdits + 1, sizeof(int));
+    paiVar = (int*)R_alloc(nEdits + 1, sizeof(int));
+    padValue = (double*)R_alloc(nEdits + 1, sizeof(double));
+    for(e = 0; e < nEdits; e++)
+    {
+        int nAt = panPos[panVariant[e]]++;
+
+        panKind[nAt] = INTEGER(spanKind)[e];
+        paiIndex[nAt] = INTEGER(spaiIndex)[e];
+        paiVar[nAt] = INTEGER(spaiVar)[e];
+        padValue[nAt] = REAL(spadValue)[e];
+    }
+
+    PROTECT(spanErr = NEW_INTEGER(nVariants));
+    PROTECT(spanStatus = NEW_INTEGER(nVariants));
+    PROTECT(spadObj = NEW_NUMERIC(nVariants));
+    PROTECT(spadTime = NEW_NUMERIC(nVariants));
+    nProtect += 4;
+    if(bSolutions)
+    {
+        PROTECT(spadPrimal = allocMatrix(REALSXP, nVars, nVariants));
+        nProtect += 1;
+    }
+
+    memset(&pool, 0, sizeof(pool));
+    pool.nJobs = nVariants;
+    pool.nMethod = Rf_asInteger(snMethod);
+    pool.nVars = nVars;
+    pool.dNA = NA_REAL;
+    pool.papModel = (pLSmodel*)R_alloc(nVariants, sizeof(pLSmodel));
+    pool.pabMIP = (int*)R_alloc(nVariants, sizeof(int));
+    pool.panErr = INTEGER(spanErr);
+    pool.panStatus = INTEGER(spanStatus);
+    pool.padObj = REAL(spadObj);
+    pool.padTime = REAL(spadTime);
+    pool.padPrimal = bSolutions ? REAL(spadPrimal) : NULL;
+    memset(pool.papModel, 0, nVariants * sizeof(pLSmodel));
+
+    /* build the clones on this thread; a variant that cannot be built keeps
+       its error code and is skipped by the workers */
+    for(k = 0; k < nVariants; k++)
+    {
+        pLSmodel pClone;
+
+        pool.panStatus[k] = 0;
+        pool.padObj[k] = NA_REAL;
+        pool.padTime[k] = 0.0;
+        pool.pabMIP[k] = FALSE;
+        if(bSolutions)
+        {
+            for(e = 0; e < nVars; e++) pool.padPrimal[(size_t)k * nVars + e] = NA_REAL;
+        }
+
+        nErr = LSERR_NO_ERROR;
+        pClone = LScreateModel(pEnv, &nErr);
+        if(pClone == NULL || nErr)
+        {
+            pool.panErr[k] = nErr ? nErr : LSERR_OUT_OF_MEMORY;
+            continue;
+        }
+        nErr = LSloadLPData(pClone, nCons, nVars, nObjSense, dObjConst, padC, padB,
+                            pachConTypes, nNnz, paiAcols, panAcols, padAcoef, paiArows,
+                            padL, padU);
+        if(!nErr && nVars > 0) nErr = LSloadVarType(pClone, pachVarTypes);
+        if(!nErr) nErr = LScopyParam(pModel, pClone, nSolverType);
+        if(!nErr && panBeg[k + 1] > panBeg[k])
+        {
+            nErr = rApplyEdits(pClone, panBeg[k + 1] - panBeg[k], panKind + panBeg[k],
+                               paiIndex + panBeg[k], paiVar + panBeg[k],
+                               padValue + panBeg[k], FALSE, &iFailed);
+        }
+        if(!nErr)
+        {
+            nInt = nBin = 0;
+            LSgetInfo(pClone, LS_IINFO_NUM_INT, &nInt);
+            LSgetInfo(pClone, LS_IINFO_NUM_BIN, &nBin);
+            pool.pabMIP[k] = nInt + nBin > 0;
+        }
+        pool.panErr[k] = nErr;
+        if(nErr)
+        {
+            LSdeleteModel(&pClone);
+            continue;
+        }
+        pool.papModel[k] = pClone;
+    }
+
+    rHoldEnvLog(prModel->prEnv);
+
+    /* the calling thread works too, so a failed thread start only costs
+       parallelism */
+    rMutexInit(&pool.lock);
+    paThread = (rThread_t*)R_alloc(nThreads, sizeof(rThread_t));
+    for(k = 0; k < nThreads - 1; k++)
+    {
+        if(rThreadStart(&paThread[nStarted], rPoolWorker, &pool) == 0)
+        {
+            nStarted++;
+        }
+    }
+    rPoolWorker(&pool);
+    for(k = 0; k < nStarted; k++)
+    {
+        rThreadJoin(paThread[k]);
+    }
+    rMutexDestroy(&pool.lock);
+
+    rReleaseEnvLog(prModel->prEnv);
+
+    for(k = 0; k < nVariants; k++)
+    {
+        if(pool.papModel[k] != NULL)
+        {
+            LSdeleteModel(&pool.papModel[k]);
+        }
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spanErr);
+        SET_VECTOR_ELT(rList, 2, spanStatus);
+        SET_VECTOR_ELT(rList, 3, spadObj);
+        SET_VECTOR_ELT(rList, 4, spadTime);
+        SET_VECTOR_ELT(rList, 5, spadPrimal);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+
+#define rLS_ASYNC_LP   0
+#define rLS_ASYNC_MIP  1
+#define rLS_ASYNC_GOP  2
+
+/* A solve running on a background thread. While it runs the model's R
+   callbacks are replaced by native ones that record progress here, and
+   every wrapper taking the model refuses it. Fields below lock are shared
+   with the solver thread. */
+typedef struct rLSasync
+{
+    rThread_t thread;
+    prLSmodel prModel;     /* NULL once reaped */
+    pLSmodel  pModel;
+    int       nSolver;
+    int       nMethod;
+    int       nVars;
+    int       bReaped;     /* thread joined and callbacks restored */
+
+    rMutex_t  lock;
+    int       bDone;
+    int       bCancel;
+    int       nErrorCode;  /* of the solve, set when done */
+    int       nStatus;     /* final status when done, else the current one */
+    int       nLocation;   /* of the last callback */
+    int       nIter;
+    int       nBranches;
+    double    dObj;
+    double    dBestBound;
+    double    dTime;
+    int       nIncumbents;
+    double    dIncObj;
+    double    *padIncumbent;
+} rLSasync;
+
+RTHREAD_FUNC(rAsyncWorker)
+{
+    rLSasync *pAsync = (rLSasync*)pArg;
+    int      nErr, nStatus = 0;
+
+    if(pAsync->nSolver == rLS_ASYNC_MIP)
+    {
+        nErr = LSsolveMIP(pAsync->pModel, &nStatus);
+    }
+    else if(pAsync->nSolver == rLS_ASYNC_GOP)
+    {
+        nErr = LSsolveGOP(pAsync->pModel, &nStatus);
+    }
+    else
+    {
+        nErr = LSoptimize(pAsync->pModel, pAsync->nMethod, &nStatus);
+    }
+
+    rMutexLock(&pAsync->lock);
+    pAsync->nErrorCode = nErr;
+    pAsync->nStatus = nStatus;
+    pAsync->bDone = TRUE;
+    rMutexUnlock(&pAsync->lock);
+
+    RTHREAD_RETURN;
+}
+
+/* Runs on the solver thread; a nonzero return interrupts the solver */
+static int CALLBACKTYPE rAsyncCallback(pLSmodel pModel,
+                                       int      nLocation,
+                                       void     *pData)
+{
+    rLSasync *pAsync = (rLSasync*)pData;
+    int      nIter, nStatus, nBranches, bCancel;
+    double   dObj, dBound, dTime;
+    int      bIter, bStatus, bBranches, bObj, bBound, bTime;
+
+    bIter = LSgetProgressInfo(pModel, nLocation, LS_IINFO_CUR_ITER, &nIter) == LSERR_NO_ERROR;
+    bStatus = LSgetProgressInfo(pModel, nLocation, LS_IINFO_CUR_STATUS, &nStatus) == LSERR_NO_ERROR;
+    bBranches = LSgetProgressInfo(pModel, nLocation, LS_IINFO_CUR_BRANCH_COUNT, &nBranches) == LSERR_NO_ERROR;
+    bObj = LSgetProgressInfo(pModel, nLocation, LS_DINFO_CUR_OBJ, &dObj) == LSERR_NO_ERROR;
+    bBound = LSgetProgressInfo(pModel, nLocation, LS_DINFO_CUR_BEST_BOUND, &dBound) == LSERR_NO_ERROR;
+    bTime = LSgetProgressInfo(pModel, nLocation, LS_DINFO_CUR_TIME, &dTime) == LSERR_NO_ERROR;
+
+    rMutexLock(&pAsync->lock);
+    pAsync->nLocation = nLocation;
+    if(bIter) pAsync->nIter = nIter;
+    if(bStatus) pAsync->nStatus = nStatus;
+    if(bBranches) pAsync->nBranches = nBranches;
+    if(bObj) pAsync->dObj = dObj;
+    if(bBound) pAsync->dBestBound = dBound;
+    if(bTime) pAsync->dTime = dTime;
+    bCancel = pAsync->bCancel;
+    rMutexUnlock(&pAsync->lock);
+
+    return bCancel;
+}
+
+/* Runs on the solver thread at each new integer solution */
+static int CALLBACKTYPE rAsyncMIPCallback(pLSmodel pModel,
+                                          void     *pData,
+                                          double   dObjval,
+                                          double   *padPrimal)
+{
+    rLSasync *pAsync = (rLSasync*)pData;
+    int      bCancel;
+
+    rMutexLock(&pAsync->lock);
+    memcpy(pAsync->padIncumbent, padPrimal, pAsync->nVars * sizeof(double));
+    pAsync->dIncObj = dObjval;
+    pAsync->nIncumbents++;
+    bCancel = pAsync->bCancel;
+    rMutexUnlock(&pAsync->lock);
+
+    return bCancel;
+}
+
+/* Keeps log lines in the model's ring for delivery once the solve is reaped */
+static void LS_CALLTYPE rAsyncBufferLog(pLSmodel model,
+                                        char     *line,
+                                        void     *pData)
+{
+    rAppendLogLine(((prLSmodel)pData)->pLogBuf, line);
+}
+
+/* Reinstalls the callbacks the model had before the solve */
+static void rAsyncRestoreCallbacks(prLSmodel prModel)
+{
+    pLSmodel     pModel = prModel->pModel;
+    rLindoData_t *rudata = prModel->pCbData;
+
+    if(rudata->cbFunc != NULL)
+    {
+        LSsetCallback(pModel, relayCallback, rudata);
+    }
+    else if(prModel->nCbIntervalMs >= 0)
+    {
+        LSsetCallback(pModel, (cbFunc_t)rCallBack, prModel);
+    }
+    else
+    {
+        LSsetCallback(pModel, NULL, NULL);
+    }
+
+    if(rudata->mipFunc != NULL)
+    {
+        LSsetMIPCallback(pModel, relayMIPCallback, rudata);
+    }
+    else
+    {
+        LSsetMIPCallback(pModel, NULL, NULL);
+    }
+
+    rRestoreModelLog(prModel);
+}
+
+/* Joins the solver thread and hands the model back to R. Log lines kept
+   during the solve are delivered when bFlush is set. */
+static void rAsyncReap(rLSasync *pAsync, int bFlush)
+{
+    prLSmodel prModel = pAsync->prModel;
+
+    if(pAsync->bReaped)
+    {
+        return;
+    }
+
+    rThreadJoin(pAsync->thread);
+    pAsync->bReaped = TRUE;
+
+    rAsyncRestoreCallbacks(prModel);
+    rReleaseEnvLog(prModel->prEnv);
+    prModel->pAsync = NULL;
+    pAsync->prModel = NULL;
+
+    if(bFlush)
+    {
+        rFlushLogBuf(prModel);
+    }
+}
+
+static int rAsyncBusy(prLSmodel prModel)
+{
+    rLSasync *pAsync = prModel->pAsync;
+    int      bDone;
+
+    rMutexLock(&pAsync->lock);
+    bDone = pAsync->bDone;
+    rMutexUnlock(&pAsync->lock);
+
+    if(!bDone)
+    {
+        return TRUE;
+    }
+
+    rAsyncReap(pAsync, TRUE);
+
+    return FALSE;
+}
+
+/* Cancels the solve and waits for it, used when the model or the handle
+   goes away */
+static void rAsyncStop(rLSasync *pAsync)
+{
+    rMutexLock(&pAsync->lock);
+    pAsync->bCancel = TRUE;
+    rMutexUnlock(&pAsync->lock);
+
+    rAsyncReap(pAsync, FALSE);
+}
+
+static void rFinalizeAsync(SEXP sAsync)
+{
+    rLSasync *pAsync = (rLSasync*)R_ExternalPtrAddr(sAsync);
+
+    if(pAsync != NULL)
+    {
+        rAsyncStop(pAsync);
+        rMutexDestroy(&pAsync->lock);
+        free(pAsync->padIncumbent);
+        free(pAsync);
+        R_ClearExternalPtr(sAsync);
+    }
+}
+
+/*
+* @brief rcLSsolveAsync
+* @param[in] sModel
+* @param[in] snSolver  0 for LSoptimize, 1 for LSsolveMIP, 2 for LSsolveGOP
+* @param[in] snMethod  method passed to LSoptimize
+* @return a handle of the solve, NULL on failure
+* @remark Models with R functions set by rLSsetFuncalc or rLSsetGradcalc
+*         cannot be solved in the background.
+*/
+SEXP rcLSsolveAsync(SEXP sModel, SEXP snSolver, SEXP snMethod)
+{
+    prLSmodel    prModel;
+    pLSmodel     pModel;
+    rLSasync     *pAsync = NULL;
+    rLindoData_t *rudata;
+    int          nSolver = Rf_asInteger(snSolver);
+    int          nErrorCode = LSERR_NO_ERROR;
+    int          *pnErrorCode = &nErrorCode;
+    SEXP         sAsync = R_NilValue;
+
+    CHECK_MODEL_ERROR;
+
+    if(nSolver != rLS_ASYNC_LP && nSolver != rLS_ASYNC_MIP && nSolver != rLS_ASYNC_GOP)
+    {
+        error("rLindo Error: nSolver must be 0 (LP), 1 (MIP) or 2 (GOP)");
+    }
+
+    /* R function evaluators would have to run on the solver thread */
+    rudata = prModel->pCbData;
+    if(rudata->Funcalc_func != NULL || rudata->Grad_func != NULL ||
+       rudata->Grad_func2 != NULL || rudata->Hessdc_func != NULL)
+    {
+        nErrorCode = LSERR_NOT_SUPPORTED;
+        goto ErrorReturn;
+    }
+
+    pAsync = (rLSasync*)calloc(1, sizeof(rLSasync));
+    if(pAsync == NULL)
+    {
+        nErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
+    }
+    nErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_VARS, &pAsync->nVars);
+    if(nErrorCode)
+    {
+        free(pAsync);
+        goto ErrorReturn;
+    }
+    pAsync->padIncumbent = (double*)malloc((pAsync->nVars > 0 ? pAsync->nVars : 1) * sizeof(double));
+    if(pAsync->padIncumbent == NULL)
+    {
+        free(pAsync);
+        nErrorCode = LSERR_OUT_OF_MEMORY;
+        goto ErrorReturn;
+    }
+    pAsync->prModel = prModel;
+    pAsync->pModel = pModel;
+    pAsync->nSolver = nSolver;
+    pAsync->nMethod = Rf_asInteger(snMethod);
+    pAsync->dObj = NA_REAL;
+    pAsync->dBestBound = NA_REAL;
+    pAsync->dIncObj = NA_REAL;
+    rMutexInit(&pAsync->lock);
+
+    LSsetCallback(pModel, (cbFunc_t)rAsyncCallback, pAsync);
+    LSsetMIPCallback(pModel, rAsyncMIPCallback, pAsync);
+    if(!prModel->bLogOff && prModel->pLogBuf != NULL)
+    {
+        LSsetModelLogfunc(pModel, rAsyncBufferLog, prModel);
+    }
+    else
+    {
+        LSsetModelLogfunc(pModel, NULL, NULL);
+    }
+    rHoldEnvLog(prModel->prEnv);
+
+    if(rThreadStart(&pAsync->thread, rAsyncWorker, pAsync) != 0)
+    {
+        rReleaseEnvLog(prModel->prEnv);
+        rAsyncRestoreCallbacks(prModel);
+        rMutexDestroy(&pAsync->lock);
+        free(pAsync->padIncumbent);
+        free(pAsync);
+        nErrorCode = LSERR_INTERNAL_ERROR;
+        goto ErrorReturn;
+    }
+    prModel->pAsync = pAsync;
+
+ErrorReturn:
+    if(nErrorCode)
+    {
+        Rprintf("Failed to start the solve (error %d)\n",nErrorCode);
+        R_FlushConsole();
+        return R_NilValue;
+    }
+
+    /* the handle keeps the model alive */
+    PROTECT(sAsync = R_MakeExternalPtr(pAsync,R_NilValue,sModel));
+
+    R_SetExternalPtrTag(sAsync,tagLSasync);
+
+    R_RegisterCFinalizerEx(sAsync,rFinalizeAsync,TRUE);
+
+    UNPROTECT(1);
+
+    return sAsync;
+}
+
+/*
+* @brief rcLSasyncPoll
+* @param[in] sAsync
+* @return int An integer error code, that of the solve once it is done
+* @remark ErrorCode,bDone,pnStatus,pnIter,pnBranches,pdObj,pdBestBound,pdTime,pnIncumbents
+*         = rLSasyncPoll(handle)
+*/
+SEXP rcLSasyncPoll(SEXP sAsync)
+{
+    rLSasync  *pAsync;
+    int       bDone = FALSE;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      sbDone = R_NilValue;
+    SEXP      spnStatus = R_NilValue;
+    SEXP      spnIter = R_NilValue;
+    SEXP      spnBranches = R_NilValue;
+    SEXP      spdObj = R_NilValue;
+    SEXP      spdBestBound = R_NilValue;
+    SEXP      spdTime = R_NilValue;
+    SEXP      spnIncumbents = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[9] = {"ErrorCode", "bDone", "pnStatus", "pnIter", "pnBranches",
+                           "pdObj", "pdBestBound", "pdTime", "pnIncumbents"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 9;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ASYNC_ERROR;
+
+    PROTECT(spnStatus = NEW_INTEGER(1));
+    PROTECT(spnIter = NEW_INTEGER(1));
+    PROTECT(spnBranches = NEW_INTEGER(1));
+    PROTECT(spdObj = NEW_NUMERIC(1));
+    PROTECT(spdBestBound = NEW_NUMERIC(1));
+    PROTECT(spdTime = NEW_NUMERIC(1));
+    PROTECT(spnIncumbents = NEW_INTEGER(1));
+    nProtect += 7;
+
+    rMutexLock(&pAsync->lock);
+    bDone = pAsync->bDone;
+    if(bDone)
+    {
+        *pnErrorCode = pAsync->nErrorCode;
+    }
+    INTEGER(spnStatus)[0] = pAsync->nStatus;
+    INTEGER(spnIter)[0] = pAsync->nIter;
+    INTEGER(spnBranches)[0] = pAsync->nBranches;
+    REAL(spdObj)[0] = pAsync->dObj;
+    REAL(spdBestBound)[0] = pAsync->dBestBound;
+    REAL(spdTime)[0] = pAsync->dTime;
+    INTEGER(spnIncumbents)[0] = pAsync->nIncumbents;
+    rMutexUnlock(&pAsync->lock);
+
+    if(bDone)
+    {
+        rAsyncReap(pAsync, TRUE);
+    }
+
+    PROTECT(sbDone = ScalarLogical(bDone));
+    nProtect += 1;
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    SET_VECTOR_ELT(rList, 1, sbDone);
+    SET_VECTOR_ELT(rList, 2, spnStatus);
+    SET_VECTOR_ELT(rList, 3, spnIter);
+    SET_VECTOR_ELT(rList, 4, spnBranches);
+    SET_VECTOR_ELT(rList, 5, spdObj);
+    SET_VECTOR_ELT(rList, 6, spdBestBound);
+    SET_VECTOR_ELT(rList, 7, spdTime);
+    SET_VECTOR_ELT(rList, 8, spnIncumbents);
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSasyncIncumbent
+* @param[in] sAsync
+* @return int An integer error code, LSERR_INFO_NOT_AVAILABLE if no solution
+*         has been found yet
+* @remark While the solve runs this is the last integer solution reported to
+*         the MIP callback; once it is done, the model's final solution.
+* @remark ErrorCode,pdObj,padPrimal = rLSasyncIncumbent(handle)
+*/
+SEXP rcLSasyncIncumbent(SEXP sAsync)
+{
+    rLSasync  *pAsync;
+    prLSmodel prModel = NULL;
+    int       bDone;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spdObj = R_NilValue;
+    SEXP      spadPrimal = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[3] = {"ErrorCode", "pdObj", "padPrimal"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 3;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ASYNC_ERROR;
+
+    PROTECT(spdObj = NEW_NUMERIC(1));
+    PROTECT(spadPrimal = NEW_NUMERIC(pAsync->nVars));
+    nProtect += 2;
+
+    rMutexLock(&pAsync->lock);
+    bDone = pAsync->bDone;
+    rMutexUnlock(&pAsync->lock);
+
+    if(bDone && !pAsync->bReaped)
+    {
+        prModel = pAsync->prModel;
+        rAsyncReap(pAsync, TRUE);
+    }
+    else if(bDone)
+    {
+        /* the model may have changed since, use it only while it is idle
+           and of the same size */
+        SEXP sModel = R_ExternalPtrProtected(sAsync);
+        int  nVars = -1;
+
+        prModel = (prLSmodel)R_ExternalPtrAddr(sModel);
+        if(prModel != NULL &&
+           (prModel->pAsync != NULL || prModel->pModel == NULL ||
+            LSgetInfo(prModel->pModel, LS_IINFO_NUM_VARS, &nVars) != LSERR_NO_ERROR ||
+            nVars != pAsync->nVars))
+        {
+            prModel = NULL;
+        }
+    }
+
+    if(prModel != NULL)
+    {
+        if(pAsync->nSolver == rLS_ASYNC_MIP)
+        {
+            *pnErrorCode = LSgetMIPPrimalSolution(prModel->pModel, REAL(spadPrimal));
+            if(!*pnErrorCode) *pnErrorCode = LSgetInfo(prModel->pModel, LS_DINFO_MIP_OBJ, REAL(spdObj));
+        }
+        else
+        {
+            *pnErrorCode = LSgetPrimalSolution(prModel->pModel, REAL(spadPrimal));
+            if(!*pnErrorCode) *pnErrorCode = LSgetInfo(prModel->pModel,
+                pAsync->nSolver == rLS_ASYNC_GOP ? LS_DINFO_GOP_OBJ : LS_DINFO_POBJ, REAL(spdObj));
+        }
+    }
+    else
+    {
+        rMutexLock(&pAsync->lock);
+        if(pAsync->nIncumbents > 0)
+        {
+            memcpy(REAL(spadPrimal), pAsync->padIncumbent, pAsync->nVars * sizeof(double));
+            REAL(spdObj)[0] = pAsync->dIncObj;
+        }
+        else
+        {
+            *pnErrorCode = LSERR_INFO_NOT_AVAILABLE;
+        }
+        rMutexUnlock(&pAsync->lock);
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spdObj);
+        SET_VECTOR_ELT(rList, 2, spadPrimal);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSasyncCancel
+* @param[in] sAsync
+* @param[in] sbWait  whether to wait until the solver has stopped
+* @return int An integer error code
+* @remark The solver stops at its next callback.
+*/
+SEXP rcLSasyncCancel(SEXP sAsync, SEXP sbWait)
+{
+    rLSasync  *pAsync;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[1] = {"ErrorCode"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 1;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ASYNC_ERROR;
+
+    rMutexLock(&pAsync->lock);
+    pAsync->bCancel = TRUE;
+    rMutexUnlock(&pAsync->lock);
+
+    if(Rf_asLogical(sbWait) == TRUE)
+    {
+        rAsyncReap(pAsync, TRUE);
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSasyncWait
+* @param[in] sAsync
+* @param[in] snTimeoutMs  longest wait, <0 to wait until the solve is done
+* @return int An integer error code, that of the solve once it is done
+* @remark The wait can be interrupted from R, the solve keeps running.
+* @remark ErrorCode,bDone,pnStatus = rLSasyncWait(handle,nTimeoutMs)
+*/
+SEXP rcLSasyncWait(SEXP sAsync, SEXP snTimeoutMs)
+{
+    rLSasync  *pAsync;
+    int       nTimeoutMs = Rf_asInteger(snTimeoutMs);
+    int       bDone = FALSE, nStatus = 0;
+    double    dStart = rMonotonicMs();
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      sbDone = R_NilValue;
+    SEXP      spnStatus = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[3] = {"ErrorCode", "bDone", "pnStatus"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 3;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_ASYNC_ERROR;
+
+    for(;;)
+    {
+        rMutexLock(&pAsync->lock);
+        bDone = pAsync->bDone;
+        nStatus = pAsync->nStatus;
+        if(bDone)
+        {
+            *pnErrorCode = pAsync->nErrorCode;
+        }
+        rMutexUnlock(&pAsync->lock);
+
+        if(bDone || (nTimeoutMs != NA_INTEGER && nTimeoutMs >= 0 &&
+                     rMonotonicMs() - dStart >= nTimeoutMs))
+        {
+            break;
+        }
+        R_CheckUserInterrupt();
+        rSleepMs(10);
+    }
+
+    if(bDone)
+    {
+        rAsyncReap(pAsync, TRUE);
+    }
+
+    PROTECT(sbDone = ScalarLogical(bDone));
+    PROTECT(spnStatus = ScalarInteger(nStatus));
+    nProtect += 2;
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    SET_VECTOR_ELT(rList, 1, sbDone);
+    SET_VECTOR_ELT(rList, 2, spnStatus);
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+
+#define rLS_SCEN_PRIMAL    0
+#define rLS_SCEN_DUAL      1
+#define rLS_SCEN_SLACKS    2
+#define rLS_SCEN_REDCOST   3
+#define rLS_SCEN_NKINDS    4
+
+/* Destination of a bulk scenario extraction. Matrices have one row per
+   scenario of the range, NULL when not requested. */
+typedef struct rLindoScenJob_t {
+    prLSmodel prModel;
+    pLSmodel pModel;
+    int      jBeg;         /* first scenario of the range, row 0 */
+    int      nScen;        /* rows */
+    int      nVars;        /* core columns */
+    int      nCons;        /* core rows */
+    double   *apadOut[rLS_SCEN_NKINDS];
+    double   *padObj;
+    double   *padProb;
+} rLindoScenJob_t;
+
+/* Copies a scenario's vector into its row of a column-major matrix */
+static void rScatterRow(double *padMat, int nRows, int iRow, double *padVec, int nLen)
+{
+    int k;
+
+    for(k = 0; k < nLen; k++)
+    {
+        padMat[iRow + (size_t)k * nRows] = padVec[k];
+    }
+}
+
+/* Fills the rows of scenarios jFrom..jTo-1. padBuf holds the larger of
+   nVars and nCons values. Makes no R API calls. */
+static int rGetScenarioRows(rLindoScenJob_t *pJob, int jFrom, int jTo, double *padBuf)
+{
+    pLSmodel pModel = pJob->pModel;
+    int      j, iRow, nErrorCode = LSERR_NO_ERROR;
+    double   dObj;
+
+    for(j = jFrom; j < jTo && nErrorCode == LSERR_NO_ERROR; j++)
+    {
+        iRow = j - pJob->jBeg;
+        if(pJob->apadOut[rLS_SCEN_PRIMAL])
+        {
+            nErrorCode = LSgetScenarioPrimalSolution(pModel, j, padBuf, &dObj);
+            if(nErrorCode) break;
+            rScatterRow(pJob->apadOut[rLS_SCEN_PRIMAL], pJob->nScen, iRow, padBuf, pJob->nVars);
+        }
+        if(pJob->apadOut[rLS_SCEN_DUAL])
+        {
+            nErrorCode = LSgetScenarioDualSolution(pModel, j, padBuf);
+            if(nErrorCode) break;
+            rScatterRow(pJob->apadOut[rLS_SCEN_DUAL], pJob->nScen, iRow, padBuf, pJob->nCons);
+        }
+        if(pJob->apadOut[rLS_SCEN_SLACKS])
+        {
+            nErrorCode = LSgetScenarioSlacks(pModel, j, padBuf);
+            if(nErrorCode) break;
+            rScatterRow(pJob->apadOut[rLS_SCEN_SLACKS], pJob->nScen, iRow, padBuf, pJob->nCons);
+        }
+        if(pJob->apadOut[rLS_SCEN_REDCOST])
+        {
+            nErrorCode = LSgetScenarioReducedCost(pModel, j, padBuf);
+            if(nErrorCode) break;
+            rScatterRow(pJob->apadOut[rLS_SCEN_REDCOST], pJob->nScen, iRow, padBuf, pJob->nVars);
+        }
+        if(pJob->padObj)
+        {
+            nErrorCode = LSgetScenarioObjective(pModel, j, pJob->padObj + iRow);
+            if(nErrorCode) break;
+        }
+        if(pJob->padProb)
+        {
+            nErrorCode = LSgetProbabilityByScenario(pModel, j, pJob->padProb + iRow);
+        }
+    }
+
+    return nErrorCode;
+}
+
+/* A slice of a bulk scenario extraction run on its own thread */
+typedef struct rLindoScenSlice_t {
+    rLindoScenJob_t *pJob;
+    int      jFrom;
+    int      jTo;
+    double   *padBuf;
+    int      nErrorCode;
+} rLindoScenSlice_t;
+
+RTHREAD_FUNC(rScenarioSliceWorker)
+{
+    rLindoScenSlice_t *pSlice = (rLindoScenSlice_t*)pArg;
+
+    pSlice->nErrorCode = rGetScenarioRows(pSlice->pJob, pSlice->jFrom, pSlice->jTo,
+                                          pSlice->padBuf);
+
+    RTHREAD_RETURN;
+}
+
+/* Fills the rows of scenarios jFrom..jTo-1 on up to nThreads threads.
+   Slice k covers scenarios [jFrom + k*nPer, jFrom + (k+1)*nPer); the calling
+   thread takes slice 0, and a slice whose thread fails to start is run here
+   too. Returns the error code of the first failing slice. Calling thread
+   only, buffers come from R_alloc. The R log functions of the model and its
+   env are off while the workers run. */
+static int rGetScenarioRowsParallel(rLindoScenJob_t *pJob, int jFrom, int jTo, int nThreads)
+{
+    int               nScen = jTo - jFrom, nBufLen, nPer, k;
+    int               nErrorCode = LSERR_NO_ERROR;
+    rLindoScenSlice_t *paSlice;
+    rThread_t         *paThread;
+    int               *pbStarted;
+
+    if(nThreads == NA_INTEGER || nThreads < 1)
+    {
+        nThreads = 1;
+    }
+    if(nThreads > nScen)
+    {
+        nThreads = nScen > 0 ? nScen : 1;
+    }
+
+    nBufLen = (pJob->nVars > pJob->nCons ? pJob->nVars : pJob->nCons) + 1;
+    nPer = (nScen + nThreads - 1) / nThreads;
+    paSlice = (rLindoScenSlice_t*)R_alloc(nThreads, sizeof(rLindoScenSlice_t));
+    paThread = (rThread_t*)R_alloc(nThreads, sizeof(rThread_t));
+    pbStarted = (int*)R_alloc(nThreads, sizeof(int));
+    for(k = 0; k < nThreads; k++)
+    {
+        paSlice[k].pJob = pJob;
+        paSlice[k].jFrom = jFrom + k * nPer < jTo ? jFrom + k * nPer : jTo;
+        paSlice[k].jTo = jFrom + (k + 1) * nPer < jTo ? jFrom + (k + 1) * nPer : jTo;
+        paSlice[k].padBuf = (double*)R_alloc(nBufLen, sizeof(double));
+        paSlice[k].nErrorCode = LSERR_NO_ERROR;
+    }
+    if(nThreads > 1)
+    {
+        rHoldEnvLog(pJob->prModel->prEnv);
+        LSsetModelLogfunc(pJob->pModel, NULL, NULL);
+    }
+    for(k = 0; k < nThreads; k++)
+    {
+        pbStarted[k] = k > 0 && rThreadStart(&paThread[k], rScenarioSliceWorker, &paSlice[k]) == 0;
+    }
+    for(k = 0; k < nThreads; k++)
+    {
+        if(!pbStarted[k])
+        {
+            rScenarioSliceWorker(&paSlice[k]);
+        }
+    }
+    for(k = 0; k < nThreads; k++)
+    {
+        if(pbStarted[k])
+        {
+            rThreadJoin(paThread[k]);
+        }
+        if(nErrorCode == LSERR_NO_ERROR)
+        {
+            nErrorCode = paSlice[k].nErrorCode;
+        }
+    }
+    if(nThreads > 1)
+    {
+        rRestoreModelLog(pJob->prModel);
+        rReleaseEnvLog(pJob->prModel->prEnv);
+    }
+
+    return nErrorCode;
+}
+
+/*
+* @brief rcLSgetScenarioSolutions
+* @param[in] sModel
+* @param[in] spanKinds  blocks to return: 0 primal, 1 dual, 2 slacks, 3 reduced costs
+* @param[in] sjBeg      first scenario
+* @param[in] sjEnd      one past the last scenario, <0 for all
+* @param[in] sbObj      whether to return the scenario objectives
+* @param[in] sbProb     whether to return the scenario probabilities
+* @param[in] snThreads  threads reading scenarios, each filling a contiguous
+*                       range of rows
+* @return int An integer error code, that of the first failing scenario
+* @remark Each block is a scenario by core column (or row) matrix.
+* @remark ErrorCode,padPrimal,padDual,padSlacks,padReducedCost,padObj,padProb =
+*         rLSgetScenarioSolutions(model,panKinds,jBeg,jEnd,bObj,bProb,nThreads)
+*/
+SEXP rcLSgetScenarioSolutions(SEXP sModel, SEXP spanKinds, SEXP sjBeg, SEXP sjEnd,
+                              SEXP sbObj, SEXP sbProb, SEXP snThreads)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       jBeg = Rf_asInteger(sjBeg);
+    int       jEnd = Rf_asInteger(sjEnd);
+    int       nThreads = Rf_asInteger(snThreads);
+    int       nScenarios = 0, nKind, k;
+    rLindoScenJob_t job;
+    SEXP      asOut[rLS_SCEN_NKINDS];
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spadObj = R_NilValue;
+    SEXP      spadProb = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[7] = {"ErrorCode", "padPrimal", "padDual", "padSlacks",
+                           "padReducedCost", "padObj", "padProb"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 7;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    for(k = 0; k < rLS_SCEN_NKINDS; k++)
+    {
+        asOut[k] = R_NilValue;
+    }
+
+    CHECK_MODEL_ERROR;
+
+    memset(&job, 0, sizeof(job));
+    job.prModel = prModel;
+    job.pModel = pModel;
+
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_SCENARIOS, 0, &nScenarios);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_COLS_CORE, 0, &job.nVars);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_ROWS_CORE, 0, &job.nCons);
+    CHECK_ERRCODE;
+
+    if(jEnd == NA_INTEGER || jEnd < 0)
+    {
+        jEnd = nScenarios;
+    }
+    if(jBeg == NA_INTEGER || jBeg < 0 || jBeg > jEnd || jEnd > nScenarios)
+    {
+        *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+        goto ErrorReturn;
+    }
+    job.jBeg = jBeg;
+    job.nScen = jEnd - jBeg;
+
+    for(k = 0; k < Rf_length(spanKinds); k++)
+    {
+        nKind = INTEGER(spanKinds)[k];
+        if(nKind < 0 || nKind >= rLS_SCEN_NKINDS)
+        {
+            error("rLindo Error: panKinds must be in 0..3");
+        }
+        if(asOut[nKind] != R_NilValue)
+        {
+            continue;
+        }
+        PROTECT(asOut[nKind] = allocMatrix(REALSXP, job.nScen,
+                                           nKind == rLS_SCEN_DUAL || nKind == rLS_SCEN_SLACKS ?
+                                           job.nCons : job.nVars));
+        nProtect += 1;
+        job.apadOut[nKind] = REAL(asOut[nKind]);
+    }
+    if(Rf_asLogical(sbObj) == TRUE)
+    {
+        PROTECT(spadObj = NEW_NUMERIC(job.nScen));
+        nProtect += 1;
+        job.padObj = REAL(spadObj);
+    }
+    if(Rf_asLogical(sbProb) == TRUE)
+    {
+        PROTECT(spadProb = NEW_NUMERIC(job.nScen));
+        nProtect += 1;
+        job.padProb = REAL(spadProb);
+    }
+
+    *pnErrorCode = rGetScenarioRowsParallel(&job, jBeg, jEnd, nThreads);
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        for(k = 0; k < rLS_SCEN_NKINDS; k++)
+        {
+            SET_VECTOR_ELT(rList, k + 1, asOut[k]);
+        }
+        SET_VECTOR_ELT(rList, 5, spadObj);
+        SET_VECTOR_ELT(rList, 6, spadProb);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+
+/* Scenario result file written by rcLSwriteScenarioSolutionsBinary, in the
+   byte order of the writing machine:
+     char[8]  "RLSCEN1"
+     int32    version (1), block mask (bit k for kind k, bit 4 objectives,
+              bit 5 probabilities), core columns, core rows, first scenario,
+              scenarios, scenarios per chunk, 0
+   then one chunk per nChunk scenarios:
+     int32    first scenario of the chunk, scenarios in the chunk (nRows)
+     double   each present block in kind order as an nRows by ncol
+              column-major matrix, then nRows objectives, then nRows
+              probabilities */
+#define rLS_SCENFILE_MAGIC   "RLSCEN1"
+#define rLS_SCENFILE_VERSION 1
+#define rLS_SCENFILE_OBJ     (1 << rLS_SCEN_NKINDS)
+#define rLS_SCENFILE_PROB    (1 << (rLS_SCEN_NKINDS + 1))
+
+static int rWriteDoubles(FILE *pFile, double *padVal, size_t nVal)
+{
+    if(nVal > 0 && fwrite(padVal, sizeof(double), nVal, pFile) != nVal)
+    {
+        return LSERR_CANNOT_OPEN_FILE;
+    }
+
+    return LSERR_NO_ERROR;
+}
+
+/*
+* @brief rcLSwriteScenarioSolutionsBinary
+* @param[in] sModel
+* @param[in] sFileName
+* @param[in] spanKinds  blocks to write: 0 primal, 1 dual, 2 slacks, 3 reduced costs
+* @param[in] sjBeg      first scenario
+* @param[in] sjEnd      one past the last scenario, <0 for all
+* @param[in] sbObj      whether to write the scenario objectives
+* @param[in] sbProb     whether to write the scenario probabilities
+* @param[in] snChunk    scenarios held in memory at a time
+* @param[in] snThreads  threads reading the scenarios of a chunk
+* @return int An integer error code
+* @remark Memory use is bounded by nChunk rows of the requested blocks.
+* @remark ErrorCode,pnScenarios = rLSwriteScenarioSolutionsBinary(model,pszFname,
+*         panKinds,jBeg,jEnd,bObj,bProb,nChunk,nThreads)
+*/
+SEXP rcLSwriteScenarioSolutionsBinary(SEXP sModel, SEXP sFileName, SEXP spanKinds,
+                                      SEXP sjBeg, SEXP sjEnd, SEXP sbObj, SEXP sbProb,
+                                      SEXP snChunk, SEXP snThreads)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    const char *pszFname = CHAR(STRING_ELT(sFileName, 0));
+    int       jBeg = Rf_asInteger(sjBeg);
+    int       jEnd = Rf_asInteger(sjEnd);
+    int       nChunk = Rf_asInteger(snChunk);
+    int       nThreads = Rf_asInteger(snThreads);
+    int       nScenarios = 0, nMask = 0, nKind, j, k;
+    int       anHeader[8], anChunk[2];
+    double    *apadChunk[rLS_SCEN_NKINDS], *padObj = NULL, *padProb = NULL;
+    FILE      *pFile = NULL;
+    rLindoScenJob_t job;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spnScenarios = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[2] = {"ErrorCode", "pnScenarios"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 2;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    PROTECT(spnScenarios = ScalarInteger(0));
+    nProtect += 1;
+
+    CHECK_MODEL_ERROR;
+
+    memset(&job, 0, sizeof(job));
+    job.prModel = prModel;
+    job.pModel = pModel;
+
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_SCENARIOS, 0, &nScenarios);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_COLS_CORE, 0, &job.nVars);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_ROWS_CORE, 0, &job.nCons);
+    CHECK_ERRCODE;
+
+    if(jEnd == NA_INTEGER || jEnd < 0)
+    {
+        jEnd = nScenarios;
+    }
+    if(jBeg == NA_INTEGER || jBeg < 0 || jBeg > jEnd || jEnd > nScenarios)
+    {
+        *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+        goto ErrorReturn;
+    }
+    if(nChunk == NA_INTEGER || nChunk < 1)
+    {
+        error("rLindo Error: nChunk must be positive");
+    }
+    if(nChunk > jEnd - jBeg)
+    {
+        nChunk = jEnd - jBeg > 0 ? jEnd - jBeg : 1;
+    }
+
+    for(k = 0; k < Rf_length(spanKinds); k++)
+    {
+        nKind = INTEGER(spanKinds)[k];
+        if(nKind < 0 || nKind >= rLS_SCEN_NKINDS)
+        {
+            error("rLindo Error: panKinds must be in 0..3");
+        }
+        nMask |= 1 << nKind;
+    }
+    for(k = 0; k < rLS_SCEN_NKINDS; k++)
+    {
+        apadChunk[k] = NULL;
+        if(nMask & (1 << k))
+        {
+            apadChunk[k] = (double*)R_alloc((size_t)nChunk *
+                                            (k == rLS_SCEN_DUAL || k == rLS_SCEN_SLACKS ?
+                                             job.nCons : job.nVars) + 1, sizeof(double));
+        }
+    }
+    if(Rf_asLogical(sbObj) == TRUE)
+    {
+        nMask |= rLS_SCENFILE_OBJ;
+        padObj = (double*)R_alloc(nChunk, sizeof(double));
+    }
+    if(Rf_asLogical(sbProb) == TRUE)
+    {
+        nMask |= rLS_SCENFILE_PROB;
+        padProb = (double*)R_alloc(nChunk, sizeof(double));
+    }
+
+    pFile = fopen(pszFname, "wb");
+    if(pFile == NULL)
+    {
+        *pnErrorCode = LSERR_CANNOT_OPEN_FILE;
+        goto ErrorReturn;
+    }
+
+    anHeader[0] = rLS_SCENFILE_VERSION;
+    anHeader[1] = nMask;
+    anHeader[2] = job.nVars;
+    anHeader[3] = job.nCons;
+    anHeader[4] = jBeg;
+    anHeader[5] = jEnd - jBeg;
+    anHeader[6] = nChunk;
+    anHeader[7] = 0;
+    if(fwrite(rLS_SCENFILE_MAGIC, 1, 8, pFile) != 8 ||
+       fwrite(anHeader, sizeof(int), 8, pFile) != 8)
+    {
+        *pnErrorCode = LSERR_CANNOT_OPEN_FILE;
+        goto ErrorReturn;
+    }
+
+    for(j = jBeg; j < jEnd; j += nChunk)
+    {
+        const void *vmax = vmaxget();
+        int        nRows = jEnd - j < nChunk ? jEnd - j : nChunk;
+
+        job.jBeg = j;
+        job.nScen = nRows;
+        for(k = 0; k < rLS_SCEN_NKINDS; k++)
+        {
+            job.apadOut[k] = apadChunk[k];
+        }
+        job.padObj = padObj;
+        job.padProb = padProb;
+
+        *pnErrorCode = rGetScenarioRowsParallel(&job, j, j + nRows, nThreads);
+        vmaxset(vmax);
+        CHECK_ERRCODE;
+
+        anChunk[0] = j;
+        anChunk[1] = nRows;
+        if(fwrite(anChunk, sizeof(int), 2, pFile) != 2)
+        {
+            *pnErrorCode = LSERR_CANNOT_OPEN_FILE;
+            goto ErrorReturn;
+        }
+        for(k = 0; k < rLS_SCEN_NKINDS && *pnErrorCode == LSERR_NO_ERROR; k++)
+        {
+            if(apadChunk[k])
+            {
+                *pnErrorCode = rWriteDoubles(pFile, apadChunk[k], (size_t)nRows *
+                                             (k == rLS_SCEN_DUAL || k == rLS_SCEN_SLACKS ?
+                                              job.nCons : job.nVars));
+            }
+        }
+        if(*pnErrorCode == LSERR_NO_ERROR && padObj)
+        {
+            *pnErrorCode = rWriteDoubles(pFile, padObj, nRows);
+        }
+        if(*pnErrorCode == LSERR_NO_ERROR && padProb)
+        {
+            *pnErrorCode = rWriteDoubles(pFile, padProb, nRows);
+        }
+        CHECK_ERRCODE;
+
+        INTEGER(spnScenarios)[0] += nRows;
+    }
+
+ErrorReturn:
+    if(pFile != NULL && fclose(pFile) != 0 && *pnErrorCode == LSERR_NO_ERROR)
+    {
+        *pnErrorCode = LSERR_CANNOT_OPEN_FILE;
+    }
+
+    //allocate list
+    SET_UP_LIST;
+
+    SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    SET_VECTOR_ELT(rList, 1, spnScenarios);
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+
+/* Fills the CSR block of node primal or dual values: paiBeg[i] is the offset
+   of node i in padVal, read from the first scenario through the node. */
+static int rGetNodeBlocks(pLSmodel  pModel,
+                          int       nNodes,
+                          int       *paiStage,
+                          int       *paiScenario,
+                          int       *paiBeg,
+                          double    *padVal,
+                          int       bDual)
+{
+    int nErrorCode = LSERR_NO_ERROR;
+    int i;
+
+    for(i = 0; i < nNodes && nErrorCode == LSERR_NO_ERROR; i++)
+    {
+        if(paiBeg[i + 1] == paiBeg[i])
+        {
+            continue;
+        }
+        if(bDual)
+        {
+            nErrorCode = LSgetNodeDualSolution(pModel, paiScenario[i], paiStage[i],
+                                               padVal + paiBeg[i]);
+        }
+        else
+        {
+            nErrorCode = LSgetNodePrimalSolution(pModel, paiScenario[i], paiStage[i],
+                                                 padVal + paiBeg[i]);
+        }
+    }
+
+    return nErrorCode;
+}
+
+/*
+* @brief rcLSgetScenarioTree
+* @param[in] sModel
+* @param[in] sbPrimal  whether to return the node primal solutions
+* @param[in] sbDual    whether to return the node dual solutions
+* @return int An integer error code
+* @remark The tree is rebuilt from the node path of every scenario. Node i has
+*         parent paiParent[i] (-1 for the root), stage paiStage[i] and
+*         probability padProb[i]; paiScenario[i] is the first scenario through
+*         it. Its children are paiChild[paiChildBeg[i]..paiChildBeg[i+1]-1] and
+*         its primal and dual blocks are stored the same way in padPrimal and
+*         padDual.
+* @remark ErrorCode,paiParent,paiStage,padProb,paiScenario,paiChildBeg,paiChild,
+*         paiPrimalBeg,padPrimal,paiDualBeg,padDual = rLSgetScenarioTree(model,
+*         bPrimal,bDual)
+*/
+SEXP rcLSgetScenarioTree(SEXP sModel, SEXP sbPrimal, SEXP sbDual)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       nNodes = 0, nStages = 0, nScenarios = 0, nPath, nChild, nNode;
+    int       i, j, s;
+    int       *paiPath, *panColsStage, *panRowsStage, *paiNext;
+    int       *paiParent, *paiStage, *paiScenario, *paiChildBeg, *paiChild;
+    int       *paiPrimalBeg = NULL, *paiDualBeg = NULL;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spaiParent = R_NilValue;
+    SEXP      spaiStage = R_NilValue;
+    SEXP      spadProb = R_NilValue;
+    SEXP      spaiScenario = R_NilValue;
+    SEXP      spaiChildBeg = R_NilValue;
+    SEXP      spaiChild = R_NilValue;
+    SEXP      spaiPrimalBeg = R_NilValue;
+    SEXP      spadPrimal = R_NilValue;
+    SEXP      spaiDualBeg = R_NilValue;
+    SEXP      spadDual = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[11] = {"ErrorCode", "paiParent", "paiStage", "padProb",
+                            "paiScenario", "paiChildBeg", "paiChild",
+                            "paiPrimalBeg", "padPrimal", "paiDualBeg", "padDual"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 11;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_NODES, 0, &nNodes);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_STAGES, 0, &nStages);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_SCENARIOS, 0, &nScenarios);
+    CHECK_ERRCODE;
+
+    PROTECT(spaiParent = NEW_INTEGER(nNodes));
+    nProtect += 1;
+    paiParent = INTEGER_POINTER(spaiParent);
+    PROTECT(spaiStage = NEW_INTEGER(nNodes));
+    nProtect += 1;
+    paiStage = INTEGER_POINTER(spaiStage);
+    PROTECT(spaiScenario = NEW_INTEGER(nNodes));
+    nProtect += 1;
+    paiScenario = INTEGER_POINTER(spaiScenario);
+    for(i = 0; i < nNodes; i++)
+    {
+        paiParent[i] = -1;
+        paiStage[i] = -1;
+        paiScenario[i] = -1;
+    }
+
+    //each scenario is a root to leaf path, one node per stage
+    paiPath = (int*)R_alloc(nStages + 1, sizeof(int));
+    for(j = 0; j < nScenarios; j++)
+    {
+        *pnErrorCode = LSgetNodeListByScenario(pModel, j, NULL, &nPath);
+        CHECK_ERRCODE;
+        if(nPath > nStages + 1)
+        {
+            paiPath = (int*)R_alloc(nPath, sizeof(int));
+        }
+        *pnErrorCode = LSgetNodeListByScenario(pModel, j, paiPath, NULL);
+        CHECK_ERRCODE;
+
+        for(s = 0; s < nPath; s++)
+        {
+            nNode = paiPath[s];
+            if(nNode < 0 || nNode >= nNodes)
+            {
+                *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+                goto ErrorReturn;
+            }
+            if(paiScenario[nNode] < 0)
+            {
+                paiStage[nNode] = s;
+                paiParent[nNode] = s > 0 ? paiPath[s - 1] : -1;
+                paiScenario[nNode] = j;
+            }
+        }
+    }
+
+    PROTECT(spadProb = NEW_NUMERIC(nNodes));
+    nProtect += 1;
+    for(i = 0; i < nNodes; i++)
+    {
+        *pnErrorCode = LSgetProbabilityByNode(pModel, i, REAL(spadProb) + i);
+        CHECK_ERRCODE;
+    }
+
+    //children in CSR form, grouped by parent in node order
+    PROTECT(spaiChildBeg = NEW_INTEGER(nNodes + 1));
+    nProtect += 1;
+    paiChildBeg = INTEGER_POINTER(spaiChildBeg);
+    memset(paiChildBeg, 0, (nNodes + 1) * sizeof(int));
+    nChild = 0;
+    for(i = 0; i < nNodes; i++)
+    {
+        if(paiParent[i] >= 0)
+        {
+            paiChildBeg[paiParent[i] + 1]++;
+            nChild++;
+        }
+    }
+    for(i = 0; i < nNodes; i++)
+    {
+        paiChildBeg[i + 1] += paiChildBeg[i];
+    }
+    PROTECT(spaiChild = NEW_INTEGER(nChild));
+    nProtect += 1;
+    paiChild = INTEGER_POINTER(spaiChild);
+    paiNext = (int*)R_alloc(nNodes + 1, sizeof(int));
+    memcpy(paiNext, paiChildBeg, (nNodes + 1) * sizeof(int));
+    for(i = 0; i < nNodes; i++)
+    {
+        if(paiParent[i] >= 0)
+        {
+            paiChild[paiNext[paiParent[i]]++] = i;
+        }
+    }
+
+    if(Rf_asLogical(sbPrimal) == TRUE || Rf_asLogical(sbDual) == TRUE)
+    {
+        panColsStage = (int*)R_alloc(nStages + 1, sizeof(int));
+        panRowsStage = (int*)R_alloc(nStages + 1, sizeof(int));
+        for(s = 0; s < nStages; s++)
+        {
+            *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_COLS_STAGE, s,
+                                         &panColsStage[s]);
+            CHECK_ERRCODE;
+            *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_ROWS_STAGE, s,
+                                         &panRowsStage[s]);
+            CHECK_ERRCODE;
+        }
+
+        if(Rf_asLogical(sbPrimal) == TRUE)
+        {
+            PROTECT(spaiPrimalBeg = NEW_INTEGER(nNodes + 1));
+            nProtect += 1;
+            paiPrimalBeg = INTEGER_POINTER(spaiPrimalBeg);
+        }
+        if(Rf_asLogical(sbDual) == TRUE)
+        {
+            PROTECT(spaiDualBeg = NEW_INTEGER(nNodes + 1));
+            nProtect += 1;
+            paiDualBeg = INTEGER_POINTER(spaiDualBeg);
+        }
+        for(i = 0; i <= nNodes; i++)
+        {
+            //nodes no scenario passes through have no values
+            int bHas = i > 0 && paiStage[i - 1] >= 0 && paiStage[i - 1] < nStages;
+
+            if(paiPrimalBeg)
+            {
+                paiPrimalBeg[i] = i == 0 ? 0 :
+                                  paiPrimalBeg[i - 1] + (bHas ? panColsStage[paiStage[i - 1]] : 0);
+            }
+            if(paiDualBeg)
+            {
+                paiDualBeg[i] = i == 0 ? 0 :
+                                paiDualBeg[i - 1] + (bHas ? panRowsStage[paiStage[i - 1]] : 0);
+            }
+        }
+
+        if(paiPrimalBeg)
+        {
+            PROTECT(spadPrimal = NEW_NUMERIC(paiPrimalBeg[nNodes]));
+            nProtect += 1;
+            *pnErrorCode = rGetNodeBlocks(pModel, nNodes, paiStage, paiScenario,
+                                          paiPrimalBeg, REAL(spadPrimal), FALSE);
+            CHECK_ERRCODE;
+        }
+        if(paiDualBeg)
+        {
+            PROTECT(spadDual = NEW_NUMERIC(paiDualBeg[nNodes]));
+            nProtect += 1;
+            *pnErrorCode = rGetNodeBlocks(pModel, nNodes, paiStage, paiScenario,
+                                          paiDualBeg, REAL(spadDual), TRUE);
+            CHECK_ERRCODE;
+        }
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spaiParent);
+        SET_VECTOR_ELT(rList, 2, spaiStage);
+        SET_VECTOR_ELT(rList, 3, spadProb);
+        SET_VECTOR_ELT(rList, 4, spaiScenario);
+        SET_VECTOR_ELT(rList, 5, spaiChildBeg);
+        SET_VECTOR_ELT(rList, 6, spaiChild);
+        SET_VECTOR_ELT(rList, 7, spaiPrimalBeg);
+        SET_VECTOR_ELT(rList, 8, spadPrimal);
+        SET_VECTOR_ELT(rList, 9, spaiDualBeg);
+        SET_VECTOR_ELT(rList, 10, spadDual);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+
+/*
+* @brief rcLSgetStocParSampleMatrix
+* @param[in] sModel
+* @param[in] spaiStv  indices of the stochastic parameters, NULL for all
+* @return int An integer error code
+* @remark Row i of padSample holds the sample points of parameter paiStv[i],
+*         padded with NA up to the largest sample size.
+* @remark ErrorCode,padSample,panSampSize,paiStv = rLSgetStocParSampleMatrix(model,
+*         paiStv)
+*/
+SEXP rcLSgetStocParSampleMatrix(SEXP sModel, SEXP spaiStv)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    pLSsample *paSample;
+    int       nSpars = 0, nStv, nMax = 0, i, k;
+    int       *paiStv, *panSampSize;
+    double    *padBuf, *padSample;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spadSample = R_NilValue;
+    SEXP      spanSampSize = R_NilValue;
+    SEXP      spaiStvOut = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[4] = {"ErrorCode", "padSample", "panSampSize", "paiStv"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 4;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_SPARS, &nSpars);
+    CHECK_ERRCODE;
+
+    nStv = spaiStv == R_NilValue ? nSpars : Rf_length(spaiStv);
+    PROTECT(spaiStvOut = NEW_INTEGER(nStv));
+    nProtect += 1;
+    paiStv = INTEGER_POINTER(spaiStvOut);
+    for(i = 0; i < nStv; i++)
+    {
+        paiStv[i] = spaiStv == R_NilValue ? i : INTEGER(spaiStv)[i];
+        if(paiStv[i] < 0 || paiStv[i] >= nSpars)
+        {
+            *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+            goto ErrorReturn;
+        }
+    }
+
+    //the samples belong to the model and are not freed here
+    PROTECT(spanSampSize = NEW_INTEGER(nStv));
+    nProtect += 1;
+    panSampSize = INTEGER_POINTER(spanSampSize);
+    paSample = (pLSsample*)R_alloc(nStv + 1, sizeof(pLSsample));
+    for(i = 0; i < nStv; i++)
+    {
+        paSample[i] = LSgetStocParSample(pModel, paiStv[i], -1, -1, pnErrorCode);
+        CHECK_ERRCODE;
+        *pnErrorCode = LSsampGetPoints(paSample[i], &panSampSize[i], NULL);
+        CHECK_ERRCODE;
+        if(panSampSize[i] > nMax)
+        {
+            nMax = panSampSize[i];
+        }
+    }
+
+    PROTECT(spadSample = allocMatrix(REALSXP, nStv, nMax));
+    nProtect += 1;
+    padSample = REAL(spadSample);
+    for(k = 0; k < nStv * nMax; k++)
+    {
+        padSample[k] = NA_REAL;
+    }
+    padBuf = (double*)R_alloc(nMax + 1, sizeof(double));
+    for(i = 0; i < nStv; i++)
+    {
+        *pnErrorCode = LSsampGetPoints(paSample[i], NULL, padBuf);
+        CHECK_ERRCODE;
+        rScatterRow(padSample, nStv, i, padBuf, panSampSize[i]);
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spadSample);
+        SET_VECTOR_ELT(rList, 2, spanSampSize);
+        SET_VECTOR_ELT(rList, 3, spaiStvOut);
+    }
+
+    UNPROTECT(nProtect + 2);
+
+    return rReturnList(rList);
+}
+
+/*
+* @brief rcLSgetStocParOutcomeMatrix
+* @param[in] sModel
+* @param[in] sjBeg  first scenario
+* @param[in] sjEnd  one past the last scenario, <0 for all
+* @return int An integer error code
+* @remark Row i of padVals holds the stochastic parameter outcomes of
+*         scenario jBeg+i, as rcLSgetStocParOutcomes.
+* @remark ErrorCode,padVals,padProb = rLSgetStocParOutcomeMatrix(model,jBeg,jEnd)
+*/
+SEXP rcLSgetStocParOutcomeMatrix(SEXP sModel, SEXP sjBeg, SEXP sjEnd)
+{
+    prLSmodel prModel;
+    pLSmodel  pModel;
+    int       jBeg = Rf_asInteger(sjBeg);
+    int       jEnd = Rf_asInteger(sjEnd);
+    int       nSpars = 0, nScenarios = 0, nScen, j;
+    double    *padBuf;
+
+    int       *pnErrorCode;
+    SEXP      spnErrorCode = R_NilValue;
+    SEXP      spadVals = R_NilValue;
+    SEXP      spadProb = R_NilValue;
+    SEXP      rList = R_NilValue;
+    char      *Names[3] = {"ErrorCode", "padVals", "padProb"};
+    SEXP      ListNames = R_NilValue;
+    int       nNumItems = 3;
+    int       nProtect = 0;
+
+    //errorcode item
+    INI_ERR_CODE;
+
+    CHECK_MODEL_ERROR;
+
+    *pnErrorCode = LSgetInfo(pModel, LS_IINFO_NUM_SPARS, &nSpars);
+    CHECK_ERRCODE;
+    *pnErrorCode = LSgetStocInfo(pModel, LS_IINFO_STOC_NUM_SCENARIOS, 0, &nScenarios);
+    CHECK_ERRCODE;
+
+    if(jEnd == NA_INTEGER || jEnd < 0)
+    {
+        jEnd = nScenarios;
+    }
+    if(jBeg == NA_INTEGER || jBeg < 0 || jBeg > jEnd || jEnd > nScenarios)
+    {
+        *pnErrorCode = LSERR_INDEX_OUT_OF_RANGE;
+        goto ErrorReturn;
+    }
+    nScen = jEnd - jBeg;
+
+    PROTECT(spadVals = allocMatrix(REALSXP, nScen, nSpars));
+    nProtect += 1;
+    PROTECT(spadProb = NEW_NUMERIC(nScen));
+    nProtect += 1;
+
+    padBuf = (double*)R_alloc(nSpars + 1, sizeof(double));
+    for(j = jBeg; j < jEnd; j++)
+    {
+        *pnErrorCode = LSgetStocParOutcomes(pModel, j, padBuf, REAL(spadProb) + j - jBeg);
+        CHECK_ERRCODE;
+        rScatterRow(REAL(spadVals), nScen, j - jBeg, padBuf, nSpars);
+    }
+
+ErrorReturn:
+    //allocate list
+    SET_UP_LIST;
+
+    if(*pnErrorCode != LSERR_NO_ERROR)
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+    }
+    else
+    {
+        SET_VECTOR_ELT(rList, 0, spnErrorCode);
+        SET_VECTOR_ELT(rList, 1, spadVals);
+        SET_VECTOR_ELT(rList, 2, spadProb);
+    }
+
+    UNPROTECT(nProtect + 2);
 
+    return rReturnList(rList);
 }
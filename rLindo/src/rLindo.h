@@ -12,16 +12,104 @@
 #include "Rinternals.h"
 #include "Rdefines.h"
 
+/* Row values of recently evaluated primal points, keyed by a hash of the
+   point, for user functions that return every row in one call */
+typedef struct rLindoFunCache_t {
+    int    nEntries;
+    int    iNext;       /* entry replaced on the next miss */
+    int    *pbValid;
+    unsigned long long *pnHash;
+    double *padX;       /* nEntries x nVars */
+    double *padF;       /* nEntries x (nCons + 1), objective first */
+} rLindoFunCache_t;
+
+/* Sparse gradients of all rows at the last primal point, stored by row with
+   the objective first */
+typedef struct rLindoGradCache_t {
+    int    nVars;
+    int    nRows;
+    int    bValid;
+    int    nNonzCap;
+    double *padX;
+    int    *paiRowBeg;  /* nRows + 1 */
+    int    *paiVar;
+    double *padVal;
+    double *padWork;    /* nVars, all zero between calls */
+} rLindoGradCache_t;
+
+/* Callback context owned by an env or model handle. The R closures and
+   their data are preserved while registered; sModel and sEnv are not,
+   they are only used while the owning handle is being solved. */
+typedef struct rLindoData_t {
+    void *pModel;
+    SEXP sModel;
+    void *pEnv;
+    SEXP sEnv;
+    SEXP locFunc;
+    SEXP locData;
+    SEXP cbFunc;
+    SEXP cbData;
+    SEXP mipFunc;
+    SEXP mipData;
+    SEXP Funcalc_func;
+    SEXP FData;
+    SEXP Grad_func;
+    SEXP Grad_func2; //partial gradients
+    SEXP GData;
+    SEXP Hessdc_func;
+    SEXP HDCdata;
+    int  nVars;        /* model dimensions when the callbacks were set */
+    int  nCons;
+    rLindoFunCache_t *pFunCache;  /* non-NULL for a batched funcalc */
+    int  bReusePrimal; /* pass sPrimalBuf to callbacks instead of a new vector */
+    SEXP sPrimalBuf;
+    rLindoGradCache_t *pGradCache;
+} rLindoData_t;
+
+/* Ring of the most recent log lines of a model, delivered to R in batches */
+typedef struct rLindoLogBuf_t {
+    char   **paszLines;
+    int    nCapacity;    /* lines retained for rLSgetLogBuffer */
+    int    nHead;        /* index of the oldest retained line */
+    int    nCount;       /* lines retained */
+    int    nPending;     /* lines not yet delivered */
+    int    nBatch;       /* deliver when this many lines are pending, 0 never */
+    int    nIntervalMs;  /* deliver when this much time has passed, 0 never */
+    double dLastFlushMs;
+} rLindoLogBuf_t;
+
 typedef struct rLSenv
 {
     pLSenv pEnv;
+    int    nRefs;     /* live models, samples and generators of this env */
+    int    bReleased; /* R handle deleted or collected, delete at last ref */
+    int    nLogHolds; /* native solves that suspended the R log function */
+    rLindoData_t *pCbData;
 }rLSenv;
 
 typedef rLSenv *prLSenv;
 
+/* Open-addressing hash from variable or constraint names to indices */
+typedef struct rLindoNameIndex_t {
+    int    nNames;
+    int    nSlots;      /* power of two, at least twice nNames */
+    int    *paiSlot;    /* name index or -1 */
+    int    *paiOffset;  /* offset of each name in pachArena */
+    char   *pachArena;
+} rLindoNameIndex_t;
+
 typedef struct rLSmodel
 {
     pLSmodel pModel;
+    prLSenv  prEnv;
+    rLindoData_t *pCbData;
+    int      nCbIntervalMs;  /* min time between R_ProcessEvents, <0 no callback */
+    double   dLastEventsMs;
+    rLindoLogBuf_t *pLogBuf; /* NULL unless log buffering is enabled */
+    rLindoNameIndex_t *pVarIndex; /* built on first lookup, dropped when */
+    rLindoNameIndex_t *pConIndex; /* variables or constraints change     */
+    int      bLogOff;        /* log function removed by the user */
+    struct rLSasync *pAsync; /* background solve in progress, or NULL */
 }rLSmodel;
 
 typedef rLSmodel *prLSmodel;
@@ -29,6 +117,7 @@ typedef rLSmodel *prLSmodel;
 typedef struct rLSsample
 {
     pLSsample pSample;
+    prLSenv   prEnv;  /* NULL when the sample is owned by a model */
 }rLSsample;
 
 typedef rLSsample *prLSsample;
@@ -36,14 +125,51 @@ typedef rLSsample *prLSsample;
 typedef struct rLSrandGen
 {
     pLSrandGen pRG;
+    prLSenv    prEnv;
 }rLSrandGen;
 
 typedef rLSrandGen *prLSrandGen;
 
+/* Rows, columns and coefficients staged in growable buffers before being
+   committed to a model in one call. Staged variables and constraints are
+   numbered after those the model had when the builder was created. */
+typedef struct rLSbuilder
+{
+    prLSmodel prModel;   /* model the builder was created for */
+    int    nVars0;       /* model size at creation or at the last commit */
+    int    nCons0;
+    int    nVars;        /* staged so far */
+    int    nCons;
+    int    nNnz;
+    int    nVarsCap;
+    int    nConsCap;
+    int    nNnzCap;
+    int    nNameCap;
+    int    nNameUsed;
+    int    bVarNames;    /* names given for every staged variable */
+    int    bConNames;
+    double *padC;
+    double *padL;
+    double *padU;
+    char   *pachVarTypes;
+    int    *paiVarName;  /* offsets in pachNames */
+    double *padB;
+    char   *pachConTypes;
+    int    *paiConName;
+    int    *paiRow;
+    int    *paiVar;
+    double *padVal;
+    char   *pachNames;
+}rLSbuilder;
+
+typedef rLSbuilder *prLSbuilder;
+
 extern SEXP tagLSprob;
 extern SEXP tagLSenv;
 extern SEXP tagLSsample;
 extern SEXP tagLSrandGen;
+extern SEXP tagLSbuilder;
+extern SEXP tagLSasync;
 
 /******************************************************
  * Structure Creation and Deletion Routines (5)       *
@@ -704,7 +830,7 @@ SEXP rcLSdeleteNLPobj(SEXP      sModel,
 *********************************************************/
 SEXP rcLSgetConstraintRanges(SEXP      sModel);
 
-SEXP rcLSgetObjectiveRanges(SEXP      sModel);
+SEXP rcLSgetObjectiveRanges_x(SEXP      sModel);
 
 SEXP rcLSgetBoundRanges(SEXP      sModel);
 
@@ -1309,7 +1435,8 @@ SEXP rcLSwriteDualLINDOFile(SEXP spModel,SEXP spszFname,SEXP snObjSense);
 SEXP rcLSgetGOPVariablePriority(SEXP spModel,SEXP sndxVar);
 SEXP rcLSsetXSolverLibrary(SEXP spEnv,SEXP smVendorId,SEXP sszLibrary);
 SEXP rcLSsetGOPVariablePriority(SEXP spModel,SEXP sndxVar,SEXP snPriority);
-SEXP rcLSsetObjPoolInfo(SEXP spModel,SEXP snObjIndex,SEXP smInfo,SEXP sdValue);
+SEXP rcLSsetObjPoolParam(SEXP spModel,SEXP snObjIndex,SEXP smInfo,SEXP sdValue);
+SEXP rcLSaddObjPool(SEXP spModel,SEXP spadC,SEXP smObjSense,SEXP smRank,SEXP sdRelOptTol);
 SEXP rcLSsetSETSStatei(SEXP spModel,SEXP siSet,SEXP smState);
 SEXP rcLSremObjPool(SEXP spModel,SEXP snObjIndex);
 SEXP rcLSrepairQterms(SEXP spModel,SEXP snCons,SEXP spaiCons,SEXP spaiType);
@@ -1355,4 +1482,51 @@ SEXP rcLSgetObjPoolParam(SEXP spModel, SEXP snObjIndex, SEXP smParam);
 SEXP rcLSsetEnvLogfunc(SEXP sEnv, SEXP sFunc, SEXP sData);
 SEXP rcLSgetProgressInfo(SEXP spModel, SEXP snLocation, SEXP snQuery);
 SEXP rcLSdeleteIndConstraints(SEXP spModel, SEXP snCons, SEXP spaiCons);
-SEXP rcLSloadIndData(SEXP spModel, SEXP snIndicRows, SEXP spaiIndicRows, SEXP spaiIndicCols, SEXP spaiIndicVals);
\ No newline at end of file
+SEXP rcLSloadIndData(SEXP spModel, SEXP snIndicRows, SEXP spaiIndicRows, SEXP spaiIndicCols, SEXP spaiIndicVals);
+
+/********************************************************
+* rLindo Extensions                                     *
+*********************************************************/
+SEXP rcLSsetRawMode(SEXP sbRaw);
+SEXP rcLSsetCallbackInterval(SEXP sModel, SEXP snMsec);
+SEXP rcLSsetDefaultCallbackInterval(SEXP snMsec);
+SEXP rcLSsetLogBuffer(SEXP sModel, SEXP snCapacity, SEXP snBatch, SEXP snIntervalMs);
+SEXP rcLSgetLogBuffer(SEXP sModel);
+SEXP rcLSsetFuncalcBatch(SEXP sModel, SEXP sFunc, SEXP sData, SEXP snCache);
+SEXP rcLSsetCallbackPrimalReuse(SEXP sModel, SEXP sbReuse);
+SEXP rcLSsetGradcalc(SEXP sModel, SEXP sFunc, SEXP sData, SEXP spnUseGrad);
+SEXP rcLSsetNativeFuncalc(SEXP sModel, SEXP sFuncalc, SEXP sGradcalc, SEXP sData, SEXP spnUseGrad);
+SEXP rcLSgetVariableNames(SEXP sModel, SEXP siBeg, SEXP siEnd);
+SEXP rcLSgetConstraintNames(SEXP sModel, SEXP siBeg, SEXP siEnd);
+SEXP rcLSgetConeNames(SEXP sModel, SEXP siBeg, SEXP siEnd);
+SEXP rcLSgetVariableIndices(SEXP sModel, SEXP spaszVarNames);
+SEXP rcLSgetConstraintIndices(SEXP sModel, SEXP spaszConNames);
+SEXP rcLSloadLPSparse(SEXP sModel, SEXP snObjSense, SEXP sdObjConst, SEXP spadC, SEXP spadB,
+                      SEXP spszConTypes, SEXP sA, SEXP spadL, SEXP spadU, SEXP snIndexBase);
+SEXP rcLSgetLPSparse(SEXP sModel);
+SEXP rcLScreateBuilder(SEXP sModel, SEXP snVarsHint, SEXP snConsHint, SEXP snNnzHint);
+SEXP rcLSbuilderAddVariables(SEXP sBuilder, SEXP spadC, SEXP spadL, SEXP spadU,
+                             SEXP spszVarTypes, SEXP spaszVarNames);
+SEXP rcLSbuilderAddConstraints(SEXP sBuilder, SEXP spszConTypes, SEXP spadB,
+                               SEXP spaszConNames);
+SEXP rcLSbuilderAddCoefs(SEXP sBuilder, SEXP spaiRows, SEXP spaiVars, SEXP spadVals);
+SEXP rcLSbuilderCommit(SEXP sBuilder, SEXP sModel, SEXP snObjSense, SEXP sdObjConst);
+SEXP rcLSmodifyBatch(SEXP sModel, SEXP spanKind, SEXP spaiIndex, SEXP spaiVar, SEXP spadValue);
+SEXP rcLSsolveSweep(SEXP sModel, SEXP snKind, SEXP spaiIndex, SEXP spadValues,
+                    SEXP snMethod, SEXP sbWarm, SEXP sbSolutions);
+SEXP rcLSsolvePool(SEXP sModel, SEXP snVariants, SEXP spanVariant, SEXP spanKind,
+                   SEXP spaiIndex, SEXP spaiVar, SEXP spadValue, SEXP snThreads,
+                   SEXP snMethod, SEXP snSolverType, SEXP sbSolutions);
+SEXP rcLSsolveAsync(SEXP sModel, SEXP snSolver, SEXP snMethod);
+SEXP rcLSasyncPoll(SEXP sAsync);
+SEXP rcLSasyncIncumbent(SEXP sAsync);
+SEXP rcLSasyncCancel(SEXP sAsync, SEXP sbWait);
+SEXP rcLSasyncWait(SEXP sAsync, SEXP snTimeoutMs);
+SEXP rcLSgetScenarioSolutions(SEXP sModel, SEXP spanKinds, SEXP sjBeg, SEXP sjEnd,
+                              SEXP sbObj, SEXP sbProb, SEXP snThreads);
+SEXP rcLSwriteScenarioSolutionsBinary(SEXP sModel, SEXP sFileName, SEXP spanKinds,
+                                      SEXP sjBeg, SEXP sjEnd, SEXP sbObj, SEXP sbProb,
+                                      SEXP snChunk, SEXP snThreads);
+SEXP rcLSgetScenarioTree(SEXP sModel, SEXP sbPrimal, SEXP sbDual);
+SEXP rcLSgetStocParSampleMatrix(SEXP sModel, SEXP spaiStv);
+SEXP rcLSgetStocParOutcomeMatrix(SEXP sModel, SEXP sjBeg, SEXP sjEnd);
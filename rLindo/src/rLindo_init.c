@@ -0,0 +1,442 @@
+/*  rLindo_init.c
+    The R interface to LINDO API 11.0 - 16.0
+    This file registers all C wrapper functions with R.
+    Copyright (C) 2017-2025 LINDO Systems.
+*/
+
+#include "rLindo.h"
+#include "R_ext/Rdynload.h"
+
+#define CALLDEF(name, n)  {#name, (DL_FUNC) &name, n}
+
+static const R_CallMethodDef CallEntries[] = {
+    CALLDEF(rcLScreateEnv,                  0),
+    CALLDEF(rcLScreateEnvByKey,             1),
+    CALLDEF(rcLScreateModel,                1),
+    CALLDEF(rcLSdeleteEnv,                  1),
+    CALLDEF(rcLSdeleteModel,                1),
+    CALLDEF(rcLScopyParam,                  3),
+    CALLDEF(rcLSreadMPSFile,                3),
+    CALLDEF(rcLSwriteMPSFile,               3),
+    CALLDEF(rcLSreadLINDOFile,              2),
+    CALLDEF(rcLSwriteLINDOFile,             2),
+    CALLDEF(rcLSreadLINDOStream,            3),
+    CALLDEF(rcLSwriteLINGOFile,             2),
+    CALLDEF(rcLSwriteDualMPSFile,           4),
+    CALLDEF(rcLSwriteSolution,              2),
+    CALLDEF(rcLSwriteSolutionOfType,        3),
+    CALLDEF(rcLSwriteIIS,                   2),
+    CALLDEF(rcLSwriteIUS,                   2),
+    CALLDEF(rcLSreadMPIFile,                2),
+    CALLDEF(rcLSwriteMPIFile,               2),
+    CALLDEF(rcLSwriteWithSetsAndSC,         3),
+    CALLDEF(rcLSreadBasis,                  3),
+    CALLDEF(rcLSwriteBasis,                 3),
+    CALLDEF(rcLSreadLPFile,                 2),
+    CALLDEF(rcLSreadLPStream,               3),
+    CALLDEF(rcLSreadSDPAFile,               2),
+    CALLDEF(rcLSsetPrintLogNull,            1),
+    CALLDEF(rcLSgetErrorMessage,            2),
+    CALLDEF(rcLSgetFileError,               1),
+    CALLDEF(rcLSgetErrorRowIndex,           1),
+    CALLDEF(rcLSsetModelDouParameter,       3),
+    CALLDEF(rcLSgetModelDouParameter,       2),
+    CALLDEF(rcLSsetModelIntParameter,       3),
+    CALLDEF(rcLSgetModelIntParameter,       2),
+    CALLDEF(rcLSsetEnvDouParameter,         3),
+    CALLDEF(rcLSgetEnvDouParameter,         2),
+    CALLDEF(rcLSsetEnvIntParameter,         3),
+    CALLDEF(rcLSgetEnvIntParameter,         2),
+    CALLDEF(rcLSreadModelParameter,         2),
+    CALLDEF(rcLSreadEnvParameter,           2),
+    CALLDEF(rcLSwriteModelParameter,        2),
+    CALLDEF(rcLSgetIntParameterRange,       2),
+    CALLDEF(rcLSgetDouParameterRange,       2),
+    CALLDEF(rcLSgetParamShortDesc,          2),
+    CALLDEF(rcLSgetParamLongDesc,           2),
+    CALLDEF(rcLSgetParamMacroName,          2),
+    CALLDEF(rcLSgetParamMacroID,            2),
+    CALLDEF(rcLSgetQCEigs,                  7),
+    CALLDEF(rcLSloadLPData,                 15),
+    CALLDEF(rcLSloadQCData,                 6),
+    CALLDEF(rcLSloadConeData,               6),
+    CALLDEF(rcLSloadPOSDData,               7),
+    CALLDEF(rcLSloadSETSData,               6),
+    CALLDEF(rcLSloadSemiContData,           5),
+    CALLDEF(rcLSloadVarType,                2),
+    CALLDEF(rcLSloadNameData,               9),
+    CALLDEF(rcLSloadNLPData,                8),
+    CALLDEF(rcLSloadInstruct,               19),
+    CALLDEF(rcLSaddInstruct,                19),
+    CALLDEF(rcLSloadStringData,             3),
+    CALLDEF(rcLSloadString,                 2),
+    CALLDEF(rcLSdeleteStringData,           1),
+    CALLDEF(rcLSdeleteString,               1),
+    CALLDEF(rcLSgetStringValue,             2),
+    CALLDEF(rcLSgetConstraintProperty,      2),
+    CALLDEF(rcLSsetConstraintProperty,      3),
+    CALLDEF(rcLSloadMultiStartSolution,     2),
+    CALLDEF(rcLSloadGASolution,             2),
+    CALLDEF(rcLSaddQCShift,                 3),
+    CALLDEF(rcLSgetQCShift,                 2),
+    CALLDEF(rcLSresetQCShift,               2),
+    CALLDEF(rcLSloadBasis,                  3),
+    CALLDEF(rcLSloadVarPriorities,          2),
+    CALLDEF(rcLSreadVarPriorities,          2),
+    CALLDEF(rcLSloadVarStartPoint,          2),
+    CALLDEF(rcLSloadVarStartPointPartial,   4),
+    CALLDEF(rcLSloadMIPVarStartPoint,       2),
+    CALLDEF(rcLSloadMIPVarStartPointPartial,4),
+    CALLDEF(rcLSreadVarStartPoint,          2),
+    CALLDEF(rcLSloadBlockStructure,         5),
+    CALLDEF(rcLSoptimize,                   2),
+    CALLDEF(rcLSsolveMIP,                   1),
+    CALLDEF(rcLSsolveGOP,                   1),
+    CALLDEF(rcLSoptimizeQP,                 1),
+    CALLDEF(rcLScheckConvexity,             1),
+    CALLDEF(rcLSsolveSBD,                   4),
+    CALLDEF(rcLSgetIInfo,                   2),
+    CALLDEF(rcLSgetDInfo,                   2),
+    CALLDEF(rcLSgetProfilerInfo,            2),
+    CALLDEF(rcLSgetProfilerContext,         2),
+    CALLDEF(rcLSgetPrimalSolution,          1),
+    CALLDEF(rcLSgetDualSolution,            1),
+    CALLDEF(rcLSgetReducedCosts,            1),
+    CALLDEF(rcLSgetReducedCostsCone,        1),
+    CALLDEF(rcLSgetSlacks,                  1),
+    CALLDEF(rcLSgetBasis,                   1),
+    CALLDEF(rcLSgetSolution,                2),
+    CALLDEF(rcLSgetMIPPrimalSolution,       1),
+    CALLDEF(rcLSgetMIPDualSolution,         1),
+    CALLDEF(rcLSgetMIPReducedCosts,         1),
+    CALLDEF(rcLSgetMIPSlacks,               1),
+    CALLDEF(rcLSgetMIPBasis,                1),
+    CALLDEF(rcLSgetNextBestMIPSol,          1),
+    CALLDEF(rcLSgetLPData,                  1),
+    CALLDEF(rcLSgetQCData,                  1),
+    CALLDEF(rcLSgetQCDatai,                 2),
+    CALLDEF(rcLSgetVarType,                 1),
+    CALLDEF(rcLSgetVarStartPoint,           1),
+    CALLDEF(rcLSgetVarStartPointPartial,    1),
+    CALLDEF(rcLSgetMIPVarStartPointPartial, 1),
+    CALLDEF(rcLSgetMIPVarStartPoint,        1),
+    CALLDEF(rcLSgetSETSData,                1),
+    CALLDEF(rcLSgetSETSDatai,               2),
+    CALLDEF(rcLSgetSemiContData,            1),
+    CALLDEF(rcLSgetLPVariableDataj,         2),
+    CALLDEF(rcLSgetVariableNamej,           2),
+    CALLDEF(rcLSgetVariableIndex,           2),
+    CALLDEF(rcLSgetConstraintNamei,         2),
+    CALLDEF(rcLSgetConstraintIndex,         2),
+    CALLDEF(rcLSgetConstraintDatai,         2),
+    CALLDEF(rcLSgetLPConstraintDatai,       2),
+    CALLDEF(rcLSgetConeNamei,               2),
+    CALLDEF(rcLSgetConeIndex,               2),
+    CALLDEF(rcLSgetConeDatai,               2),
+    CALLDEF(rcLSgetNLPData,                 1),
+    CALLDEF(rcLSgetNLPConstraintDatai,      2),
+    CALLDEF(rcLSgetNLPVariableDataj,        2),
+    CALLDEF(rcLSgetNLPObjectiveData,        1),
+    CALLDEF(rcLSgetDualModel,               2),
+    CALLDEF(rcLScalinfeasMIPsolution,       2),
+    CALLDEF(rcLSgetRoundMIPsolution,        4),
+    CALLDEF(rcLSgetRangeData,               1),
+    CALLDEF(rcLSaddConstraints,             8),
+    CALLDEF(rcLSaddVariables,               11),
+    CALLDEF(rcLSaddCones,                   7),
+    CALLDEF(rcLSaddSETS,                    6),
+    CALLDEF(rcLSaddQCterms,                 6),
+    CALLDEF(rcLSdeleteConstraints,          3),
+    CALLDEF(rcLSdeleteCones,                3),
+    CALLDEF(rcLSdeleteSETS,                 3),
+    CALLDEF(rcLSdeleteSemiContVars,         3),
+    CALLDEF(rcLSdeleteVariables,            3),
+    CALLDEF(rcLSdeleteQCterms,              3),
+    CALLDEF(rcLSdeleteAj,                   4),
+    CALLDEF(rcLSmodifyLowerBounds,          4),
+    CALLDEF(rcLSmodifyUpperBounds,          4),
+    CALLDEF(rcLSmodifyRHS,                  4),
+    CALLDEF(rcLSmodifyObjective,            4),
+    CALLDEF(rcLSmodifyAj,                   5),
+    CALLDEF(rcLSmodifyCone,                 6),
+    CALLDEF(rcLSmodifySET,                  5),
+    CALLDEF(rcLSmodifySemiContVars,         5),
+    CALLDEF(rcLSmodifyConstraintType,       4),
+    CALLDEF(rcLSmodifyVariableType,         4),
+    CALLDEF(rcLSaddNLPAj,                   5),
+    CALLDEF(rcLSaddNLPobj,                  4),
+    CALLDEF(rcLSdeleteNLPobj,               3),
+    CALLDEF(rcLSgetConstraintRanges,        1),
+    CALLDEF(rcLSgetObjectiveRanges_x,       1),
+    CALLDEF(rcLSgetBoundRanges,             1),
+    CALLDEF(rcLSgetBestBounds,              1),
+    CALLDEF(rcLSfindIIS,                    2),
+    CALLDEF(rcLSfindIUS,                    2),
+    CALLDEF(rcLSfindBlockStructure,         3),
+    CALLDEF(rcLSgetIIS,                     1),
+    CALLDEF(rcLSgetIUS,                     1),
+    CALLDEF(rcLSgetBlockStructure,          1),
+    CALLDEF(rcLSfreeSolverMemory,           1),
+    CALLDEF(rcLSfreeHashMemory,             1),
+    CALLDEF(rcLSfreeSolutionMemory,         1),
+    CALLDEF(rcLSfreeMIPSolutionMemory,      1),
+    CALLDEF(rcLSfreeGOPSolutionMemory,      1),
+    CALLDEF(rcLSsetProbAllocSizes,          7),
+    CALLDEF(rcLSsetProbNameAllocSizes,      3),
+    CALLDEF(rcLSaddEmptySpacesAcolumns,     2),
+    CALLDEF(rcLSaddEmptySpacesNLPAcolumns,  2),
+    CALLDEF(rcLSwriteDeteqMPSFile,          4),
+    CALLDEF(rcLSwriteDeteqLINDOFile,        3),
+    CALLDEF(rcLSwriteSMPSFile,              5),
+    CALLDEF(rcLSreadSMPSFile,               5),
+    CALLDEF(rcLSwriteSMPIFile,              4),
+    CALLDEF(rcLSreadSMPIFile,               4),
+    CALLDEF(rcLSwriteScenarioSolutionFile,  3),
+    CALLDEF(rcLSwriteNodeSolutionFile,      4),
+    CALLDEF(rcLSwriteScenarioMPIFile,       3),
+    CALLDEF(rcLSwriteScenarioMPSFile,       4),
+    CALLDEF(rcLSwriteScenarioLINDOFile,     3),
+    CALLDEF(rcLSsetModelStocDouParameter,   3),
+    CALLDEF(rcLSgetModelStocDouParameter,   2),
+    CALLDEF(rcLSsetModelStocIntParameter,   3),
+    CALLDEF(rcLSgetModelStocIntParameter,   2),
+    CALLDEF(rcLSgetScenarioIndex,           2),
+    CALLDEF(rcLSgetStageIndex,              2),
+    CALLDEF(rcLSgetStocParIndex,            2),
+    CALLDEF(rcLSgetStocParName,             2),
+    CALLDEF(rcLSgetScenarioName,            2),
+    CALLDEF(rcLSgetStageName,               2),
+    CALLDEF(rcLSgetStocIInfo,               3),
+    CALLDEF(rcLSgetStocDInfo,               3),
+    CALLDEF(rcLSgetStocSInfo,               3),
+    CALLDEF(rcLSgetStocCCPIInfo,            4),
+    CALLDEF(rcLSgetStocCCPDInfo,            4),
+    CALLDEF(rcLSgetStocCCPSInfo,            4),
+    CALLDEF(rcLSloadSampleSizes,            2),
+    CALLDEF(rcLSloadConstraintStages,       2),
+    CALLDEF(rcLSloadVariableStages,         2),
+    CALLDEF(rcLSloadStageData,              4),
+    CALLDEF(rcLSloadStocParData,            3),
+    CALLDEF(rcLSloadStocParNames,           3),
+    CALLDEF(rcLSgetDeteqModel,              2),
+    CALLDEF(rcLSaggregateStages,            3),
+    CALLDEF(rcLSgetStageAggScheme,          1),
+    CALLDEF(rcLSdeduceStages,               5),
+    CALLDEF(rcLSsolveSP,                    1),
+    CALLDEF(rcLSsolveHS,                    2),
+    CALLDEF(rcLSgetScenarioObjective,       2),
+    CALLDEF(rcLSgetNodePrimalSolution,      3),
+    CALLDEF(rcLSgetNodeDualSolution,        3),
+    CALLDEF(rcLSgetNodeReducedCost,         3),
+    CALLDEF(rcLSgetNodeSlacks,              3),
+    CALLDEF(rcLSgetScenarioPrimalSolution,  2),
+    CALLDEF(rcLSgetScenarioReducedCost,     2),
+    CALLDEF(rcLSgetScenarioDualSolution,    2),
+    CALLDEF(rcLSgetScenarioSlacks,          2),
+    CALLDEF(rcLSgetNodeListByScenario,      2),
+    CALLDEF(rcLSgetProbabilityByScenario,   2),
+    CALLDEF(rcLSgetProbabilityByNode,       2),
+    CALLDEF(rcLSgetStocParData,             1),
+    CALLDEF(rcLSaddDiscreteBlocks,          10),
+    CALLDEF(rcLSaddScenario,                11),
+    CALLDEF(rcLSaddDiscreteIndep,           8),
+    CALLDEF(rcLSaddParamDistIndep,          8),
+    CALLDEF(rcLSaddChanceConstraint,        6),
+    CALLDEF(rcLSsetNumStages,               2),
+    CALLDEF(rcLSgetStocParOutcomes,         2),
+    CALLDEF(rcLSloadCorrelationMatrix,      7),
+    CALLDEF(rcLSgetCorrelationMatrix,       3),
+    CALLDEF(rcLSgetStocParSample,           4),
+    CALLDEF(rcLSgetDiscreteBlocks,          2),
+    CALLDEF(rcLSgetDiscreteBlockOutcomes,   3),
+    CALLDEF(rcLSgetDiscreteIndep,           2),
+    CALLDEF(rcLSgetParamDistIndep,          2),
+    CALLDEF(rcLSgetScenario,                2),
+    CALLDEF(rcLSgetChanceConstraint,        2),
+    CALLDEF(rcLSgetSampleSizes,             1),
+    CALLDEF(rcLSgetConstraintStages,        1),
+    CALLDEF(rcLSgetVariableStages,          1),
+    CALLDEF(rcLSgetStocRowIndices,          1),
+    CALLDEF(rcLSsetStocParRG,               5),
+    CALLDEF(rcLSgetScenarioModel,           2),
+    CALLDEF(rcLSfreeStocMemory,             1),
+    CALLDEF(rcLSfreeStocHashMemory,         1),
+    CALLDEF(rcLSgetModelStocParameterInt,   2),
+    CALLDEF(rcLSgetModelStocParameterDou,   2),
+    CALLDEF(rcLSgetModelStocParameterChar,  2),
+    CALLDEF(rcLSsetModelStocParameterInt,   3),
+    CALLDEF(rcLSsetModelStocParameterDou,   3),
+    CALLDEF(rcLSsetModelStocParameterChar,  3),
+    CALLDEF(rcLSgetEnvStocParameterInt,     2),
+    CALLDEF(rcLSgetEnvStocParameterDou,     2),
+    CALLDEF(rcLSgetEnvStocParameterChar,    2),
+    CALLDEF(rcLSsetEnvStocParameterInt,     3),
+    CALLDEF(rcLSsetEnvStocParameterDou,     3),
+    CALLDEF(rcLSsetEnvStocParameterChar,    3),
+    CALLDEF(rcLSsampCreate,                 2),
+    CALLDEF(rcLSsampDelete,                 1),
+    CALLDEF(rcLSsampSetDistrParam,          3),
+    CALLDEF(rcLSsampGetDistrParam,          2),
+    CALLDEF(rcLSsampEvalDistr,              3),
+    CALLDEF(rcLSsampEvalUserDistr,          4),
+    CALLDEF(rcLSsampSetRG,                  2),
+    CALLDEF(rcLSsampGenerate,               3),
+    CALLDEF(rcLSsampGetPoints,              1),
+    CALLDEF(rcLSsampLoadPoints,             3),
+    CALLDEF(rcLSsampGetCIPoints,            1),
+    CALLDEF(rcLSsampLoadDiscretePdfTable,   4),
+    CALLDEF(rcLSsampGetDiscretePdfTable,    1),
+    CALLDEF(rcLSsampGetIInfo,               2),
+    CALLDEF(rcLSsampGetDInfo,               2),
+    CALLDEF(rcLScreateRG,                   2),
+    CALLDEF(rcLScreateRGMT,                 2),
+    CALLDEF(rcLSgetDoubleRV,                1),
+    CALLDEF(rcLSgetInt32RV,                 3),
+    CALLDEF(rcLSsetRGSeed,                  2),
+    CALLDEF(rcLSdisposeRG,                  1),
+    CALLDEF(rcLSsetDistrParamRG,            3),
+    CALLDEF(rcLSsetDistrRG,                 2),
+    CALLDEF(rcLSgetDistrRV,                 1),
+    CALLDEF(rcLSgetInitSeed,                1),
+    CALLDEF(rcLSgetRGNumThreads,            1),
+    CALLDEF(rcLSfillRGBuffer,               1),
+    CALLDEF(rcLSsolveFileLP,                6),
+    CALLDEF(rcLSsolveMipBnp,                3),
+    CALLDEF(rcLSgetVersionInfo,             0),
+    CALLDEF(rcLSwriteVarPriorities,         3),
+    CALLDEF(rcLSwriteTunerConfigString,     3),
+    CALLDEF(rcLSwriteTunerParameters,       4),
+    CALLDEF(rcLSwriteParameterAsciiDoc,     2),
+    CALLDEF(rcLSaddTunerInstance,           2),
+    CALLDEF(rcLSaddTunerOption,             3),
+    CALLDEF(rcLSaddTunerStrOption,          3),
+    CALLDEF(rcLSaddTunerZDynamic,           2),
+    CALLDEF(rcLSaddTunerZStatic,            4),
+    CALLDEF(rcLSloadLicenseString,          1),
+    CALLDEF(rcLSclearTuner,                 1),
+    CALLDEF(rcLSdisplayTunerResults,        1),
+    CALLDEF(rcLSgetTunerConfigString,       1),
+    CALLDEF(rcLSgetTunerOption,             2),
+    CALLDEF(rcLSgetTunerResult,             4),
+    CALLDEF(rcLSgetTunerSpace,              1),
+    CALLDEF(rcLSgetTunerStrOption,          2),
+    CALLDEF(rcLSloadTunerConfigFile,        2),
+    CALLDEF(rcLSloadTunerConfigString,      2),
+    CALLDEF(rcLSprintTuner,                 1),
+    CALLDEF(rcLSresetTuner,                 1),
+    CALLDEF(rcLSrunTuner,                   1),
+    CALLDEF(rcLSrunTunerFile,               2),
+    CALLDEF(rcLSrunTunerString,             2),
+    CALLDEF(rcLSsetTunerOption,             3),
+    CALLDEF(rcLSsetTunerStrOption,          3),
+    CALLDEF(rcLSwriteMPXFile,               3),
+    CALLDEF(rcLSapplyLtf,                   6),
+    CALLDEF(rcLSbnbSolve,                   2),
+    CALLDEF(rcLScalcConFunc,                3),
+    CALLDEF(rcLScalcConGrad,                5),
+    CALLDEF(rcLSwriteNLSolution,            2),
+    CALLDEF(rcLSwriteEnvParameter,          2),
+    CALLDEF(rcLSreadCBFFile,                2),
+    CALLDEF(rcLSreadMPXFile,                2),
+    CALLDEF(rcLSreadNLFile,                 2),
+    CALLDEF(rcLSwriteDualLINDOFile,         3),
+    CALLDEF(rcLSgetGOPVariablePriority,     2),
+    CALLDEF(rcLSsetXSolverLibrary,          3),
+    CALLDEF(rcLSsetGOPVariablePriority,     3),
+    CALLDEF(rcLSsetObjPoolParam,            4),
+    CALLDEF(rcLSaddObjPool,                 5),
+    CALLDEF(rcLSsetSETSStatei,              3),
+    CALLDEF(rcLSremObjPool,                 2),
+    CALLDEF(rcLSrepairQterms,               4),
+    CALLDEF(rcLSloadALLDIFFData,            7),
+    CALLDEF(rcLSloadIISPriorities,          3),
+    CALLDEF(rcLSloadNLPDense,               9),
+    CALLDEF(rcLSloadSolutionAt,             3),
+    CALLDEF(rcLSmodifyObjConstant,          2),
+    CALLDEF(rcLSreadMPXStream,              3),
+    CALLDEF(rcLSsetMIPCCStrategy,           3),
+    CALLDEF(rcLSgetNextBestSol,             1),
+    CALLDEF(rcLSgetNnzData,                 2),
+    CALLDEF(rcLSgetObjectiveRanges,         1),
+    CALLDEF(rcLSgetObjPoolNumSol,           2),
+    CALLDEF(rcLSgetPOSDData,                1),
+    CALLDEF(rcLSgetPOSDDatai,               2),
+    CALLDEF(rcLSgetProgressIInfo,           3),
+    CALLDEF(rcLSgetProgressDInfo,           3),
+    CALLDEF(rcLSgetObjective,               1),
+    CALLDEF(rcLSgetJac,                     2),
+    CALLDEF(rcLSgetIISSETs,                 1),
+    CALLDEF(rcLSgetIISInts,                 1),
+    CALLDEF(rcLSgetHess,                    2),
+    CALLDEF(rcLSsetModelLogfunc,            3),
+    CALLDEF(rcLSsetCallback,                3),
+    CALLDEF(rcLSsetMIPCallback,             3),
+    CALLDEF(rcLSsetFuncalc,                 3),
+    CALLDEF(rcLScalcObjFunc,                2),
+    CALLDEF(rcLScalcObjGrad,                4),
+    CALLDEF(rcLScheckQterms,                3),
+    CALLDEF(rcLSdisplayBlockStructure,      1),
+    CALLDEF(rcLSdoBTRAN,                    4),
+    CALLDEF(rcLSdoFTRAN,                    4),
+    CALLDEF(rcLSfindLtf,                    1),
+    CALLDEF(rcLSfreeObjPool,                1),
+    CALLDEF(rcLSgetALLDIFFData,             1),
+    CALLDEF(rcLSgetALLDIFFDatai,            2),
+    CALLDEF(rcLSgetDimensions,              1),
+    CALLDEF(rcLSgetDualMIPsolution,         1),
+    CALLDEF(rcLSgetDuplicateColumns,        2),
+    CALLDEF(rcLSgetObjPoolParam,            3),
+    CALLDEF(rcLSsetEnvLogfunc,              3),
+    CALLDEF(rcLSgetProgressInfo,            3),
+    CALLDEF(rcLSdeleteIndConstraints,       3),
+    CALLDEF(rcLSloadIndData,                5),
+    CALLDEF(rcLSsetRawMode,                 1),
+    CALLDEF(rcLSsetCallbackInterval,        2),
+    CALLDEF(rcLSsetDefaultCallbackInterval, 1),
+    CALLDEF(rcLSsetLogBuffer,               4),
+    CALLDEF(rcLSgetLogBuffer,               1),
+    CALLDEF(rcLSsetFuncalcBatch,            4),
+    CALLDEF(rcLSsetCallbackPrimalReuse,     2),
+    CALLDEF(rcLSsetGradcalc,                4),
+    CALLDEF(rcLSsetNativeFuncalc,           5),
+    CALLDEF(rcLSgetVariableNames,           3),
+    CALLDEF(rcLSgetConstraintNames,         3),
+    CALLDEF(rcLSgetConeNames,               3),
+    CALLDEF(rcLSgetVariableIndices,         2),
+    CALLDEF(rcLSgetConstraintIndices,       2),
+    CALLDEF(rcLSloadLPSparse,               10),
+    CALLDEF(rcLSgetLPSparse,                1),
+    CALLDEF(rcLScreateBuilder,              4),
+    CALLDEF(rcLSbuilderAddVariables,        6),
+    CALLDEF(rcLSbuilderAddConstraints,      4),
+    CALLDEF(rcLSbuilderAddCoefs,            4),
+    CALLDEF(rcLSbuilderCommit,              4),
+    CALLDEF(rcLSmodifyBatch,                5),
+    CALLDEF(rcLSsolveSweep,                 7),
+    CALLDEF(rcLSsolvePool,                  11),
+    CALLDEF(rcLSsolveAsync,                 3),
+    CALLDEF(rcLSasyncPoll,                  1),
+    CALLDEF(rcLSasyncIncumbent,             1),
+    CALLDEF(rcLSasyncCancel,                2),
+    CALLDEF(rcLSasyncWait,                  2),
+    CALLDEF(rcLSgetScenarioSolutions,       7),
+    CALLDEF(rcLSwriteScenarioSolutionsBinary, 9),
+    CALLDEF(rcLSgetScenarioTree,            3),
+    CALLDEF(rcLSgetStocParSampleMatrix,     2),
+    CALLDEF(rcLSgetStocParOutcomeMatrix,    3),
+    {NULL, NULL, 0}
+};
+
+void R_init_rLindo(DllInfo *dll)
+{
+    tagLSprob = Rf_install("TYPE_LSPROB");
+    tagLSenv = Rf_install("TYPE_LSENV");
+    tagLSsample = Rf_install("TYPE_LSSAMP");
+    tagLSrandGen = Rf_install("TYPE_LSRG");
+    tagLSbuilder = Rf_install("TYPE_LSBUILDER");
+    tagLSasync = Rf_install("TYPE_LSASYNC");
+
+    R_registerRoutines(dll, NULL, CallEntries, NULL, NULL);
+    R_useDynamicSymbols(dll, FALSE);
+    R_forceSymbols(dll, TRUE);
+}